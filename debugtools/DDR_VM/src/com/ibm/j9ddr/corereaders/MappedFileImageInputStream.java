@@ -0,0 +1,188 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+package com.ibm.j9ddr.corereaders;
+
+import java.io.File;
+import java.io.IOException;
+import java.io.RandomAccessFile;
+import java.nio.ByteBuffer;
+import java.nio.MappedByteBuffer;
+import java.nio.channels.FileChannel;
+import java.nio.channels.FileChannel.MapMode;
+import java.security.AccessController;
+import java.security.PrivilegedAction;
+
+import javax.imageio.stream.FileImageInputStream;
+import javax.imageio.stream.ImageInputStream;
+import javax.imageio.stream.ImageInputStreamImpl;
+
+/**
+ * An ImageInputStream over a memory-mapped file.
+ *
+ * DDR reads core files through many small, random accesses (a pointer here,
+ * a field there). With a FileImageInputStream each of those is a seek and a
+ * read system call; with this stream they are copies out of the page cache.
+ *
+ * The file is mapped lazily in fixed-size windows so that files larger than
+ * a single MappedByteBuffer can address (2GB) are supported and only the
+ * parts of the dump actually touched consume address space.
+ */
+public class MappedFileImageInputStream extends ImageInputStreamImpl
+{
+
+	private static final String DISABLE_MAPPING_SYSTEM_PROPERTY = "ddr.disable.mapped.core.files";
+
+	private static final boolean DISABLE_MAPPING;
+
+	private static final int WINDOW_SHIFT = 28;
+
+	private static final long WINDOW_SIZE = 1L << WINDOW_SHIFT;
+
+	static {
+		String disableString = AccessController.doPrivileged(new PrivilegedAction<String>() {
+			@Override
+			public String run() {
+				return System.getProperty(DISABLE_MAPPING_SYSTEM_PROPERTY);
+			}
+		});
+
+		DISABLE_MAPPING = Boolean.parseBoolean(disableString);
+	}
+
+	private final RandomAccessFile file;
+
+	private final FileChannel channel;
+
+	private final long length;
+
+	private final MappedByteBuffer[] windows;
+
+	private MappedFileImageInputStream(File file) throws IOException
+	{
+		this.file = new RandomAccessFile(file, "r");
+		try {
+			this.channel = this.file.getChannel();
+			this.length = channel.size();
+			this.windows = new MappedByteBuffer[(int) ((length + WINDOW_SIZE - 1) >>> WINDOW_SHIFT)];
+			/* Map the first window eagerly so an unusable mapping falls back to plain reads now. */
+			if (length > 0) {
+				getWindow(0);
+			}
+		} catch (IOException | RuntimeException e) {
+			this.file.close();
+			throw e;
+		}
+	}
+
+	/**
+	 * Open a stream over the given file, memory-mapping it when possible.
+	 *
+	 * Falls back to a FileImageInputStream when mapping is disabled with
+	 * -Dddr.disable.mapped.core.files=true or when the file cannot be mapped
+	 * (for example, when a 32-bit JVM runs out of address space).
+	 *
+	 * @param file the file to open
+	 * @return a stream positioned at the start of the file
+	 * @throws IOException if the file cannot be opened
+	 */
+	public static ImageInputStream open(File file) throws IOException
+	{
+		if (!DISABLE_MAPPING) {
+			try {
+				return new MappedFileImageInputStream(file);
+			} catch (IOException | OutOfMemoryError e) {
+				/* fall through to unmapped access */
+			}
+		}
+		return new FileImageInputStream(file);
+	}
+
+	private MappedByteBuffer getWindow(int index) throws IOException
+	{
+		MappedByteBuffer window = windows[index];
+		if (window == null) {
+			long start = (long) index << WINDOW_SHIFT;
+			long size = Math.min(WINDOW_SIZE, length - start);
+			window = channel.map(MapMode.READ_ONLY, start, size);
+			windows[index] = window;
+		}
+		return window;
+	}
+
+	@Override
+	public int read() throws IOException
+	{
+		checkClosed();
+		bitOffset = 0;
+		if (streamPos >= length) {
+			return -1;
+		}
+		MappedByteBuffer window = getWindow((int) (streamPos >>> WINDOW_SHIFT));
+		int value = window.get((int) (streamPos & (WINDOW_SIZE - 1))) & 0xFF;
+		streamPos += 1;
+		return value;
+	}
+
+	@Override
+	public int read(byte[] b, int off, int len) throws IOException
+	{
+		checkClosed();
+		if (off < 0 || len < 0 || off + len > b.length || off + len < 0) {
+			throw new IndexOutOfBoundsException();
+		}
+		bitOffset = 0;
+		if (len == 0) {
+			return 0;
+		}
+		if (streamPos >= length) {
+			return -1;
+		}
+		int total = (int) Math.min(len, length - streamPos);
+		int remaining = total;
+		while (remaining > 0) {
+			MappedByteBuffer window = getWindow((int) (streamPos >>> WINDOW_SHIFT));
+			int windowOffset = (int) (streamPos & (WINDOW_SIZE - 1));
+			int chunk = Math.min(remaining, window.limit() - windowOffset);
+			/* Absolute reads via a duplicate keep the shared window's position untouched. */
+			ByteBuffer view = window.duplicate();
+			view.position(windowOffset);
+			view.get(b, off, chunk);
+			off += chunk;
+			remaining -= chunk;
+			streamPos += chunk;
+		}
+		return total;
+	}
+
+	@Override
+	public long length()
+	{
+		return length;
+	}
+
+	@Override
+	public void close() throws IOException
+	{
+		super.close();
+		file.close();
+	}
+}
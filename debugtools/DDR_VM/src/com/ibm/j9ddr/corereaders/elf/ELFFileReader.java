@@ -41,6 +41,7 @@ import javax.imageio.stream.FileImageInputStream;
 import javax.imageio.stream.ImageInputStream;
 
 import com.ibm.j9ddr.corereaders.InvalidDumpFormatException;
+import com.ibm.j9ddr.corereaders.MappedFileImageInputStream;
 import com.ibm.j9ddr.corereaders.memory.IMemorySource;
 import com.ibm.j9ddr.corereaders.memory.ISymbol;
 import com.ibm.j9ddr.corereaders.memory.Symbol;
@@ -147,7 +148,7 @@ public abstract class ELFFileReader {
 	// Use openELFFile to get an ELFFile instance.
 	protected ELFFileReader(File file, ByteOrder byteOrder) throws IOException, InvalidDumpFormatException {
 		try {
-			is = new FileImageInputStream(file);
+			is = MappedFileImageInputStream.open(file);
 			is.setByteOrder(byteOrder);
 			this._file = file;
 			sourceName = file.getAbsolutePath();
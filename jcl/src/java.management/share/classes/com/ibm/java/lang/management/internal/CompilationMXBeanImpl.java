@@ -1,6 +1,6 @@
 /*[INCLUDE-IF Sidecar17]*/
 /*******************************************************************************
- * Copyright (c) 2005, 2019 IBM Corp. and others
+ * Copyright (c) 2005, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -37,7 +37,7 @@ import javax.management.ObjectName;
  * </p>
  * @since 1.5
  */
-public final class CompilationMXBeanImpl implements CompilationMXBean {
+public class CompilationMXBeanImpl implements CompilationMXBean {
 
 	private static final CompilationMXBeanImpl instance = isJITEnabled() ? new CompilationMXBeanImpl() : null;
 
@@ -48,13 +48,13 @@ public final class CompilationMXBeanImpl implements CompilationMXBean {
 	 *
 	 * @return true if a JIT is enabled, false otherwise
 	 */
-	private static native boolean isJITEnabled();
+	protected static native boolean isJITEnabled();
 
 	/**
-	 * Constructor intentionally private to prevent instantiation by others.
+	 * Constructor intentionally not public to prevent instantiation by others.
 	 * Sets the metadata for this bean.
 	 */
-	private CompilationMXBeanImpl() {
+	protected CompilationMXBeanImpl() {
 		super();
 	}
 
@@ -1,6 +1,6 @@
 /*[INCLUDE-IF Sidecar17]*/
 /*******************************************************************************
- * Copyright (c) 2008, 2019 IBM Corp. and others
+ * Copyright (c) 2008, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -769,7 +769,8 @@ public final class ManagementUtils {
 				.validateAndRegister();
 
 			// register standard optional beans
-			create(ManagementFactory.COMPILATION_MXBEAN_NAME, CompilationMXBeanImpl.getInstance())
+			create(ManagementFactory.COMPILATION_MXBEAN_NAME, com.ibm.lang.management.internal.ExtendedCompilationMXBeanImpl.getInstance())
+				.addInterface(com.ibm.lang.management.CompilationMXBean.class)
 				.addInterface(java.lang.management.CompilationMXBean.class)
 				.validateAndRegister();
 
@@ -0,0 +1,44 @@
+/*[INCLUDE-IF Sidecar17]*/
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+package com.ibm.lang.management;
+
+/**
+ * The OpenJ9 extension interface for the compilation system of the virtual machine.
+ *
+ * @since 1.8
+ */
+public interface CompilationMXBean extends java.lang.management.CompilationMXBean {
+
+	/**
+	 * Returns a report of the time spent by the JIT compiler in each compilation phase
+	 * (IL generation, each optimization, code generation and AOT relocation), aggregated
+	 * per optimization level as histograms over all successful compilations.
+	 * The statistics are only collected when the JIT option
+	 * <code>-Xjit:enableCompilationPhaseStatistics</code> is specified.
+	 *
+	 * @return the compilation phase statistics report, or <code>null</code>
+	 *         if the statistics are not collected
+	 */
+	public String getCompilationPhaseStatistics();
+
+}
@@ -1,6 +1,6 @@
 /*[INCLUDE-IF Sidecar19-SE]*/
 /*******************************************************************************
- * Copyright (c) 2016, 2019 IBM Corp. and others
+ * Copyright (c) 2016, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -51,7 +51,6 @@ public final class PlatformMBeanProvider extends sun.management.spi.PlatformMBea
 		 * Inherited from DefaultPlatformMBeanProvider:
 		 *     BufferPoolMXBean
 		 *     ClassLoadingMXBean
-		 *     CompilationMXBean
 		 *     PlatformLoggingMXBean
 		 */
 
@@ -79,6 +78,11 @@ public final class PlatformMBeanProvider extends sun.management.spi.PlatformMBea
 			.addInterface(java.lang.management.ThreadMXBean.class)
 			.register(allComponents);
 
+		ComponentBuilder.create(ManagementFactory.COMPILATION_MXBEAN_NAME, ExtendedCompilationMXBeanImpl.getInstance())
+			.addInterface(com.ibm.lang.management.CompilationMXBean.class)
+			.addInterface(java.lang.management.CompilationMXBean.class)
+			.register(allComponents);
+
 		// register OpenJ9-specific singleton beans
 		ComponentBuilder.create("com.ibm.virtualization.management:type=GuestOS", GuestOS.getInstance()) //$NON-NLS-1$
 			.addInterface(com.ibm.virtualization.management.GuestOSMXBean.class)
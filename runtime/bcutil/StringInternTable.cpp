@@ -62,6 +62,7 @@ typedef struct J9InternHashTableQuery {
 	J9ClassLoader *classLoader; /* Must be parallel to J9InternHashTableEntry.classLoader */
 	UDATA length;
 	U_8 *data;
+	UDATA dataHash; /* internHashDataFn() of data, computed once so a retry with another class loader does not rehash the string */
 } J9InternHashTableQuery;
 
 
@@ -100,28 +101,31 @@ internHashEqualFn(void *leftKey, void *rightKey, void *userData)
 	return J9UTF8_DATA_EQUALS(leftUtf8Data, leftUtf8Length, rightUtf8Data, rightUtf8Length);
 }
 
+static UDATA
+internHashDataFn(U_8 *data, UDATA length)
+{
+	UDATA hash = 0;
+	for (UDATA i = 0; i < length; i++) {
+		hash = (hash << 5) - hash + data[i];
+	}
+
+	return hash;
+}
+
 static UDATA
 internHashFn(void *key, void *userData)
 {
-	UDATA length;
-	U_8 *data;
+	UDATA hash;
 
 	J9InternHashTableEntry *node = (J9InternHashTableEntry*)key;
 
 	if (NULL != node->utf8) {
-		length = UDATA(J9UTF8_LENGTH(node->utf8));
-		data = J9UTF8_DATA(node->utf8);
+		hash = internHashDataFn(J9UTF8_DATA(node->utf8), UDATA(J9UTF8_LENGTH(node->utf8)));
 	} else {
-		length = ((J9InternHashTableQuery*)node)->length;
-		data = ((J9InternHashTableQuery*)node)->data;
-	}
-
-	UDATA hash = UDATA(node->classLoader);
-	for (UDATA i = 0; i < length; i++) {
-		hash = (hash << 5) - hash + data[i];
+		hash = ((J9InternHashTableQuery*)node)->dataHash;
 	}
 
-	return hash;
+	return (hash << 5) - hash + UDATA(node->classLoader);
 }
 
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
@@ -250,6 +254,7 @@ StringInternTable::findUtf8(J9InternSearchInfo *searchInfo, J9SharedInvariantInt
 	query.classLoader = searchInfo->classloader;
 	query.length = searchInfo->stringLength;
 	query.data = searchInfo->stringData;
+	query.dataHash = internHashDataFn(query.data, query.length);
 
 	J9InternHashTableEntry *node = (J9InternHashTableEntry*)hashTableFind(_internHashTable, &query);
 
@@ -44,6 +44,10 @@
 
 #define THIS_DLL_NAME J9_DYNLOAD_DLL_NAME
 
+/* 0x0101...01 and 0x8080...80 sized to a UDATA */
+#define UTF8_WORD_LOW_BITS (((UDATA)-1) / 0xFF)
+#define UTF8_WORD_HIGH_BITS (UTF8_WORD_LOW_BITS * 0x80)
+
 static IDATA initializeTranslationBuffers (J9PortLibrary * portLib, J9TranslationBufferSet * translationBuffers);
 
 /*
@@ -251,6 +255,19 @@ j9bcutil_verifyCanonisizeAndCopyUTF8 (U_8 *dest, U_8 *source, U_32 length, U_8 *
 
 	while (source != sourceEnd) {
 
+		/* Skip a word of single byte characters (0x01..0x7F) at a time. Subtracting 1 from each byte
+		 * only sets a high bit (by borrowing) for a zero byte, so the test fails for any byte that is
+		 * zero or starts a multibyte character.
+		 */
+		if ((UDATA)(sourceEnd - source) >= sizeof(UDATA)) {
+			UDATA word = 0;
+			memcpy(&word, source, sizeof(UDATA));
+			if (0 == (((word - UTF8_WORD_LOW_BITS) | word) & UTF8_WORD_HIGH_BITS)) {
+				source += sizeof(UDATA);
+				continue;
+			}
+		}
+
 		/* Handle multibyte */
 		if (((UDATA) ((*source++) - 1)) < 0x7F) {
 			continue;
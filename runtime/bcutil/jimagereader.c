@@ -43,14 +43,15 @@ VMINLINE static U_32
 hashFn(const char *name, I_32 baseValue)
 {
 	I_32 hashcode = baseValue;
-	UDATA i = 0;
+	const char *cursor = name;
 
 	if (0 == baseValue) {
 		hashcode = JIMAGE_LOOKUP_HASH_SEED;
 	}
 
-	for (i = 0; i < strlen(name); i++) {
-		hashcode = (hashcode * JIMAGE_LOOKUP_HASH_SEED) ^ name[i];
+	/* Walk to the terminator rather than re-evaluating strlen() on every iteration */
+	for (; '\0' != *cursor; cursor++) {
+		hashcode = (hashcode * JIMAGE_LOOKUP_HASH_SEED) ^ *cursor;
 	}
 
 	return hashcode & 0x7FFFFFFF;
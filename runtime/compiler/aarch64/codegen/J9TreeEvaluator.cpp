@@ -3109,6 +3109,18 @@ J9::ARM64::CodeGenerator::inlineDirectCall(TR::Node *node, TR::Register *&result
                }
             break;
             }
+         case TR::sun_misc_Unsafe_compareAndSwapLong_jlObjectJJJ_Z:
+            {
+            if (!methodSymbol->isNative())
+               break;
+
+            if ((node->isUnsafeGetPutCASCallOnNonArray() || !TR::Compiler->om.canGenerateArraylets()) && node->isSafeForCGToFastPathUnsafeCall())
+               {
+               resultReg = VMinlineCompareAndSwap(node, cg, true);
+               return true;
+               }
+            break;
+            }
 
          default:
             break;
@@ -276,6 +276,7 @@ JIT_PRODUCT_SOURCE_FILES+=\
     compiler/compile/J9Method.cpp \
     compiler/compile/J9SymbolReferenceTable.cpp \
     compiler/control/CompilationController.cpp \
+    compiler/control/CompilationPhaseStatistics.cpp \
     compiler/control/CompilationThread.cpp \
     compiler/control/DLLMain.cpp \
     compiler/control/HookedByTheJit.cpp \
@@ -283,6 +284,7 @@ JIT_PRODUCT_SOURCE_FILES+=\
     compiler/control/JitDump.cpp \
     compiler/control/MethodToBeCompiled.cpp \
     compiler/control/rossa.cpp \
+    compiler/control/WarmRestartPlan.cpp \
     compiler/env/ClassLoaderTable.cpp \
     compiler/env/CpuUtilization.cpp \
     compiler/env/FilePointer.cpp \
@@ -405,6 +407,7 @@ JIT_PRODUCT_SOURCE_FILES+=\
     compiler/net/ServerStream.cpp \
     compiler/runtime/CompileService.cpp \
     compiler/runtime/JITClientSession.cpp \
+    compiler/runtime/JITServerAOTCache.cpp \
     compiler/runtime/JITServerIProfiler.cpp \
     compiler/runtime/JITServerROMClassHash.cpp \
     compiler/runtime/JITServerSharedROMClassCache.cpp \
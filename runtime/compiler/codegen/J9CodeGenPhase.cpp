@@ -50,6 +50,7 @@ J9::CodeGenPhase::reportPhase(PhaseValue phase)
    {
    TR_J9VMBase *fej9 = (TR_J9VMBase *)(_cg->comp()->fe());
    fej9->reportCodeGeneratorPhase(phase);
+   _cg->comp()->reportCodeGeneratorPhase();
    _currentPhase = phase;
    }
 
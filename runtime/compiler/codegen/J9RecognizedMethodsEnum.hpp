@@ -428,6 +428,13 @@
 
    jdk_internal_loader_NativeLibraries_load,
 
+   jdk_internal_vm_vector_VectorSupport_binaryOp,
+   jdk_internal_vm_vector_VectorSupport_load,
+   jdk_internal_vm_vector_VectorSupport_store,
+   jdk_internal_vm_vector_VectorSupport_compare,
+   jdk_internal_vm_vector_VectorSupport_blend,
+   jdk_internal_vm_vector_VectorSupport_reductionCoerced,
+
    java_lang_reflect_Array_getLength,
    java_util_Arrays_fill,
    java_util_Arrays_equals,
@@ -33,6 +33,7 @@
 #include "compile/Compilation_inlines.hpp"
 #include "compile/CompilationTypes.hpp"
 #include "compile/ResolvedMethod.hpp"
+#include "control/CompilationPhaseStatistics.hpp"
 #include "control/OptimizationPlan.hpp"
 #include "control/Options.hpp"
 #include "control/Options_inlines.hpp"
@@ -203,6 +204,10 @@ J9::Compilation::Compilation(int32_t id,
    if (_updateCompYieldStats)
       _hiresTimeForPreviousCallingContext = TR::Compiler->vm.getHighResClock(self());
 
+   _compilationPhaseTimer = NULL;
+   if (TR::Options::_collectCompilationPhaseStatistics)
+      _compilationPhaseTimer = new (m->trHeapMemory()) TR_CompilationPhaseTimer(TR::Compiler->vm.getHighResClock(self()));
+
    _profileInfo = new (m->trHeapMemory()) TR_AccessedProfileInfo(heapMemoryRegion);
 
    for (int i = 0; i < CACHED_CLASS_POINTER_COUNT; i++)
@@ -1254,6 +1259,8 @@ J9::Compilation::validateTargetToBeInlined(TR_ResolvedMethod *implementer)
 void
 J9::Compilation::reportILGeneratorPhase()
    {
+   if (_compilationPhaseTimer)
+      _compilationPhaseTimer->startPhase(TR_CompilationPhaseTimer::ILGenPhase, TR::Compiler->vm.getHighResClock(self()));
    self()->fej9()->reportILGeneratorPhase();
    }
 
@@ -1268,10 +1275,21 @@ J9::Compilation::reportAnalysisPhase(uint8_t id)
 void
 J9::Compilation::reportOptimizationPhase(OMR::Optimizations opts)
    {
+   if (_compilationPhaseTimer)
+      _compilationPhaseTimer->startOptimization(opts, TR::Compiler->vm.getHighResClock(self()));
    self()->fej9()->reportOptimizationPhase(opts);
    }
 
 
+void
+J9::Compilation::reportCodeGeneratorPhase()
+   {
+   // Codegen reports many sub-phases; only the transition into codegen is timed
+   if (_compilationPhaseTimer && !_compilationPhaseTimer->isInPhase(TR_CompilationPhaseTimer::CodeGenPhase))
+      _compilationPhaseTimer->startPhase(TR_CompilationPhaseTimer::CodeGenPhase, TR::Compiler->vm.getHighResClock(self()));
+   }
+
+
 void
 J9::Compilation::reportOptimizationPhaseForSnap(OMR::Optimizations opts)
    {
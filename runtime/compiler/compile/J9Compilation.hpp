@@ -56,6 +56,7 @@ class TR_ExternalValueProfileInfo;
 class TR_J9VM;
 class TR_AccessedProfileInfo;
 class TR_RelocationRuntime;
+class TR_CompilationPhaseTimer;
 namespace TR { class IlGenRequest; }
 #ifdef J9VM_OPT_JITSERVER
 struct SerializedRuntimeAssumption;
@@ -228,6 +229,14 @@ class OMR_EXTENSIBLE Compilation : public OMR::CompilationConnector
    void reportAnalysisPhase(uint8_t id);
    void reportOptimizationPhase(OMR::Optimizations);
    void reportOptimizationPhaseForSnap(OMR::Optimizations);
+   void reportCodeGeneratorPhase();
+
+   /**
+    * \brief
+    *    Returns the accumulator of the time spent in each compilation phase,
+    *    or NULL if compilation phase statistics are not collected
+    */
+   TR_CompilationPhaseTimer *getCompilationPhaseTimer() { return _compilationPhaseTimer; }
 
    CompilationPhase saveCompilationPhase();
    void restoreCompilationPhase(CompilationPhase phase);
@@ -375,6 +384,8 @@ private:
 
    uint64_t _hiresTimeForPreviousCallingContext;
 
+   TR_CompilationPhaseTimer *_compilationPhaseTimer;
+
    TR_CallingContext _previousCallingContext;
 
    uint64_t _maxYieldInterval;
@@ -29,6 +29,7 @@
 #include "control/OptimizationPlan.hpp"
 #include "control/Recompilation.hpp"
 #include "control/RecompilationInfo.hpp"
+#include "control/WarmRestartPlan.hpp"
 #include "env/IO.hpp"
 #include "env/TRMemory.hpp"
 #include "env/VerboseLog.hpp"
@@ -185,6 +186,14 @@ TR_OptimizationPlan *TR::DefaultCompilationStrategy::processEvent(TR_MethodEvent
          // use the counts to determine the first level of compilation
          // the level of compilation can be changed later on if option subsets are present
          hotnessLevel = TR::DefaultCompilationStrategy::getInitialOptLevel(event->_j9method);
+         // Follow the first compilation of this method recorded by a previous run, if any
+         if (compInfo->getWarmRestartPlan())
+            {
+            const TR_WarmRestartPlan::Entry *planEntry =
+               compInfo->getWarmRestartPlan()->findFirstCompilation(J9_ROM_METHOD_FROM_RAM_METHOD(event->_j9method));
+            if (planEntry)
+               hotnessLevel = (TR_Hotness)planEntry->_optLevel;
+            }
          if (hotnessLevel == veryHot && // we probably want to profile
             !TR::Options::getCmdLineOptions()->getOption(TR_DisableProfiling) &&
              TR::Recompilation::countingSupported() &&
@@ -468,11 +477,11 @@ TR::DefaultCompilationStrategy::processInterpreterSample(TR_MethodEvent *event)
                      if (logSampling)
                         {
                         if (n > 0)
-                           curMsg += sprintf(curMsg, " promoted from %d", n);
+                           curMsg += sprintf(curMsg, " promoted");
                         else if (n == 0)
                            curMsg += sprintf(curMsg, " comp in progress");
                         else
-                           curMsg += sprintf(curMsg, " already in the right place %d", n);
+                           curMsg += sprintf(curMsg, " already in the right place");
                         }
                      }
                   }
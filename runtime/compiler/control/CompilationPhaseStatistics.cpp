@@ -0,0 +1,294 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "control/CompilationPhaseStatistics.hpp"
+
+#include <stdarg.h>
+#include <string.h>
+#include "compile/Compilation.hpp"
+#include "infra/Bit.hpp"
+#include "infra/CriticalSection.hpp"
+#include "infra/Monitor.hpp"
+#include "optimizer/Optimizer.hpp"
+
+TR_CompilationPhaseTimer::TR_CompilationPhaseTimer(uint64_t startTime) :
+   _startTime(startTime),
+   _lastTransitionTime(startTime),
+   _currentPhase(NoPhase),
+   _currentOptimization(OMR::numOpts)
+   {
+   memset(_phaseTime, 0, sizeof(_phaseTime));
+   memset(_optimizationTime, 0, sizeof(_optimizationTime));
+   }
+
+void
+TR_CompilationPhaseTimer::charge(uint64_t crtTime)
+   {
+   // The high resolution clock is not guaranteed to be monotonic across processors
+   uint64_t elapsed = (crtTime > _lastTransitionTime) ? crtTime - _lastTransitionTime : 0;
+   _phaseTime[_currentPhase] += elapsed;
+   if (_currentPhase == OptimizerPhase && _currentOptimization < OMR::numOpts)
+      _optimizationTime[_currentOptimization] += elapsed;
+   _lastTransitionTime = crtTime;
+   }
+
+void
+TR_CompilationPhaseTimer::startPhase(Phase phase, uint64_t crtTime)
+   {
+   charge(crtTime);
+   _currentPhase = phase;
+   _currentOptimization = OMR::numOpts;
+   }
+
+void
+TR_CompilationPhaseTimer::startOptimization(OMR::Optimizations opt, uint64_t crtTime)
+   {
+   charge(crtTime);
+   _currentPhase = OptimizerPhase;
+   _currentOptimization = opt;
+   }
+
+void
+TR_CompilationPhaseTimer::stop(uint64_t crtTime)
+   {
+   startPhase(NoPhase, crtTime);
+   }
+
+
+void
+TR_CompilationPhaseStatistics::Histogram::add(uint64_t value)
+   {
+   _count++;
+   _total += value;
+   if (value > _max)
+      _max = value;
+   _buckets[bucketIndex(value)]++;
+   }
+
+uint32_t
+TR_CompilationPhaseStatistics::Histogram::bucketIndex(uint64_t value)
+   {
+   if (value < (1 << SUB_BUCKET_BITS))
+      return (uint32_t)value;
+
+   uint32_t exponent = 63 - leadingZeroes((int64_t)value);
+   if (exponent > MAX_EXPONENT)
+      return NUM_BUCKETS - 1;
+
+   uint32_t subBucket = (uint32_t)(value >> (exponent - SUB_BUCKET_BITS)) & ((1 << SUB_BUCKET_BITS) - 1);
+   return ((exponent - SUB_BUCKET_BITS + 1) << SUB_BUCKET_BITS) + subBucket;
+   }
+
+uint64_t
+TR_CompilationPhaseStatistics::Histogram::bucketLowerBound(uint32_t index)
+   {
+   if (index < (1 << SUB_BUCKET_BITS))
+      return index;
+
+   uint32_t exponent = (index >> SUB_BUCKET_BITS) + SUB_BUCKET_BITS - 1;
+   uint64_t subBucket = index & ((1 << SUB_BUCKET_BITS) - 1);
+   return ((uint64_t)1 << exponent) + (subBucket << (exponent - SUB_BUCKET_BITS));
+   }
+
+uint64_t
+TR_CompilationPhaseStatistics::Histogram::getPercentile(uint32_t percentile) const
+   {
+   if (_count == 0)
+      return 0;
+
+   uint64_t rank = (_count * percentile + 99) / 100;
+   uint64_t seen = 0;
+   for (uint32_t i = 0; i < NUM_BUCKETS; i++)
+      {
+      seen += _buckets[i];
+      if (seen >= rank)
+         return bucketLowerBound(i);
+      }
+   return _max;
+   }
+
+
+TR_CompilationPhaseStatistics::TR_CompilationPhaseStatistics() :
+   _monitor(TR::Monitor::create("JIT-CompilationPhaseStatisticsMonitor"))
+   {
+   memset(_histograms, 0, sizeof(_histograms));
+   memset(_optimizationStats, 0, sizeof(_optimizationStats));
+   }
+
+const char *
+TR_CompilationPhaseStatistics::getPhaseName(Phase phase)
+   {
+   static const char * const names[] = { "ILGen", "Optimizer", "CodeGen", "Relocation", "Total" };
+   static_assert(sizeof(names) / sizeof(names[0]) == NumPhases, "Phase names do not match the Phase enum");
+   return names[phase];
+   }
+
+void
+TR_CompilationPhaseStatistics::recordCompilation(TR_Hotness optLevel, const TR_CompilationPhaseTimer &timer, uint64_t resolution)
+   {
+   if (optLevel < noOpt || optLevel >= numHotnessLevels || resolution == 0)
+      return;
+
+   // Convert the ticks of the high resolution clock to usec outside the critical section
+   uint64_t phaseTime[NumPhases] = { 0 };
+   phaseTime[ILGenPhase] = timer.getPhaseTime(TR_CompilationPhaseTimer::ILGenPhase) * 1000000 / resolution;
+   phaseTime[OptimizerPhase] = timer.getPhaseTime(TR_CompilationPhaseTimer::OptimizerPhase) * 1000000 / resolution;
+   phaseTime[CodeGenPhase] = timer.getPhaseTime(TR_CompilationPhaseTimer::CodeGenPhase) * 1000000 / resolution;
+   for (int32_t p = TR_CompilationPhaseTimer::NoPhase; p < TR_CompilationPhaseTimer::NumPhases; p++)
+      phaseTime[TotalPhase] += timer.getPhaseTime((TR_CompilationPhaseTimer::Phase)p);
+   phaseTime[TotalPhase] = phaseTime[TotalPhase] * 1000000 / resolution;
+
+   OMR::CriticalSection recordCompilation(_monitor);
+   Histogram *histograms = _histograms[optLevel];
+   histograms[ILGenPhase].add(phaseTime[ILGenPhase]);
+   histograms[OptimizerPhase].add(phaseTime[OptimizerPhase]);
+   histograms[CodeGenPhase].add(phaseTime[CodeGenPhase]);
+   histograms[TotalPhase].add(phaseTime[TotalPhase]);
+
+   OptimizationStats *optStats = _optimizationStats[optLevel];
+   for (int32_t opt = 0; opt < OMR::numOpts; opt++)
+      {
+      uint64_t ticks = timer.getOptimizationTime((OMR::Optimizations)opt);
+      if (ticks == 0)
+         continue;
+      uint64_t usec = ticks * 1000000 / resolution;
+      optStats[opt]._count++;
+      optStats[opt]._total += usec;
+      if (usec > optStats[opt]._max)
+         optStats[opt]._max = usec;
+      }
+   }
+
+void
+TR_CompilationPhaseStatistics::recordRelocation(TR_Hotness optLevel, uint64_t usec)
+   {
+   if (optLevel < noOpt || optLevel >= numHotnessLevels)
+      return;
+
+   OMR::CriticalSection recordRelocation(_monitor);
+   _histograms[optLevel][RelocationPhase].add(usec);
+   }
+
+void
+TR_CompilationPhaseStatistics::Output::printf(const char *format, ...)
+   {
+   va_list args;
+   va_start(args, format);
+   if (_file)
+      {
+      int n = vfprintf(_file, format, args);
+      if (n > 0)
+         _length += n;
+      }
+   else
+      {
+      char *dest = (_length < _bufferSize) ? _buffer + _length : NULL;
+      size_t available = (_length < _bufferSize) ? _bufferSize - _length : 0;
+      int n = vsnprintf(dest, available, format, args);
+      if (n > 0)
+         _length += n;
+      }
+   va_end(args);
+   }
+
+void
+TR_CompilationPhaseStatistics::print(FILE *file) const
+   {
+   Output out(file);
+   print(out);
+   fflush(file);
+   }
+
+size_t
+TR_CompilationPhaseStatistics::print(char *buffer, size_t bufferSize) const
+   {
+   if (bufferSize > 0)
+      buffer[0] = '\0';
+   Output out(buffer, bufferSize);
+   print(out);
+   return out.getLength();
+   }
+
+void
+TR_CompilationPhaseStatistics::print(Output &out) const
+   {
+   OMR::CriticalSection printStats(_monitor);
+
+   out.printf("Compilation phase statistics (usec; percentiles are histogram bucket lower bounds)\n");
+   for (int32_t level = noOpt; level < numHotnessLevels; level++)
+      {
+      const Histogram *histograms = _histograms[level];
+      if (histograms[TotalPhase].getCount() == 0 && histograms[RelocationPhase].getCount() == 0)
+         continue;
+
+      out.printf("Level=%s\n", TR::Compilation::getHotnessName((TR_Hotness)level));
+      out.printf("   %-12s %10s %14s %10s %10s %10s %10s %10s\n", "Phase", "count", "total", "mean", "p50", "p90", "p99", "max");
+      for (int32_t phase = 0; phase < NumPhases; phase++)
+         {
+         const Histogram &h = histograms[phase];
+         if (h.getCount() == 0)
+            continue;
+         out.printf("   %-12s %10llu %14llu %10llu %10llu %10llu %10llu %10llu\n",
+            getPhaseName((Phase)phase),
+            (unsigned long long)h.getCount(),
+            (unsigned long long)h.getTotal(),
+            (unsigned long long)(h.getTotal() / h.getCount()),
+            (unsigned long long)h.getPercentile(50),
+            (unsigned long long)h.getPercentile(90),
+            (unsigned long long)h.getPercentile(99),
+            (unsigned long long)h.getMax());
+         }
+
+      // List the optimizations in decreasing order of total time
+      const OptimizationStats *optStats = _optimizationStats[level];
+      int32_t sortedOpts[OMR::numOpts];
+      int32_t numSortedOpts = 0;
+      for (int32_t opt = 0; opt < OMR::numOpts; opt++)
+         {
+         if (optStats[opt]._count == 0)
+            continue;
+         int32_t pos = numSortedOpts++;
+         while (pos > 0 && optStats[sortedOpts[pos - 1]]._total < optStats[opt]._total)
+            {
+            sortedOpts[pos] = sortedOpts[pos - 1];
+            pos--;
+            }
+         sortedOpts[pos] = opt;
+         }
+      if (numSortedOpts == 0)
+         continue;
+
+      uint64_t optimizerTotal = histograms[OptimizerPhase].getTotal();
+      out.printf("   %-40s %10s %14s %10s %10s %7s\n", "Optimization", "count", "total", "mean", "max", "%opt");
+      for (int32_t i = 0; i < numSortedOpts; i++)
+         {
+         const OptimizationStats &s = optStats[sortedOpts[i]];
+         out.printf("   %-40s %10llu %14llu %10llu %10llu %6.2f%%\n",
+            TR::Optimizer::getOptimizationName((OMR::Optimizations)sortedOpts[i]),
+            (unsigned long long)s._count,
+            (unsigned long long)s._total,
+            (unsigned long long)(s._total / s._count),
+            (unsigned long long)s._max,
+            optimizerTotal ? (100.0 * s._total) / optimizerTotal : 0.0);
+         }
+      }
+   }
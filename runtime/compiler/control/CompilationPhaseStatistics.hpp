@@ -0,0 +1,185 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef COMPILATIONPHASESTATISTICS_HPP
+#define COMPILATIONPHASESTATISTICS_HPP
+
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include "compile/CompilationTypes.hpp"
+#include "env/TRMemory.hpp"
+#include "optimizer/Optimizations.hpp"
+
+namespace TR { class Monitor; }
+
+/**
+ * @class TR_CompilationPhaseTimer
+ * @brief Per-compilation accumulator of the time spent in each compilation phase,
+ *        driven by the phase reports of TR::Compilation
+ *
+ * Time is measured with the high resolution clock and attributed to the phase or
+ * optimization that was reported last, up to the next phase transition.
+ */
+class TR_CompilationPhaseTimer
+   {
+public:
+   TR_ALLOC(TR_Memory::Compilation)
+
+   enum Phase
+      {
+      NoPhase,
+      ILGenPhase,
+      OptimizerPhase,
+      CodeGenPhase,
+      NumPhases
+      };
+
+   TR_CompilationPhaseTimer(uint64_t startTime);
+
+   bool isInPhase(Phase phase) const { return _currentPhase == phase; }
+   void startPhase(Phase phase, uint64_t crtTime);
+   void startOptimization(OMR::Optimizations opt, uint64_t crtTime);
+   /**
+    * @brief Charges the time elapsed since the last transition to the current phase
+    *        and stops timing
+    */
+   void stop(uint64_t crtTime);
+
+   uint64_t getStartTime() const { return _startTime; }
+   uint64_t getPhaseTime(Phase phase) const { return _phaseTime[phase]; }
+   uint64_t getOptimizationTime(OMR::Optimizations opt) const { return _optimizationTime[opt]; }
+
+private:
+   void charge(uint64_t crtTime);
+
+   uint64_t           _startTime;
+   uint64_t           _lastTransitionTime;
+   Phase              _currentPhase;
+   OMR::Optimizations _currentOptimization; // valid in OptimizerPhase; OMR::numOpts if none
+   uint64_t           _phaseTime[NumPhases];
+   uint64_t           _optimizationTime[OMR::numOpts];
+   };
+
+/**
+ * @class TR_CompilationPhaseStatistics
+ * @brief Per-opt-level histograms of the time spent in the phases of successful compilations
+ *
+ * Enabled with -Xjit:enableCompilationPhaseStatistics. The ILGen, optimizer, codegen, AOT
+ * relocation and total times of each compilation are added to log-linear histograms (four
+ * linear sub-buckets per power of two microseconds) kept separately for every opt level.
+ * The time of individual optimizations is aggregated as count, total and maximum. The
+ * statistics are printed at shutdown, on a JIT dump and on request through the
+ * CompilationMXBean.
+ */
+class TR_CompilationPhaseStatistics
+   {
+public:
+   TR_PERSISTENT_ALLOC(TR_Memory::CompilationInfo);
+
+   enum Phase
+      {
+      ILGenPhase,
+      OptimizerPhase,
+      CodeGenPhase,
+      RelocationPhase,
+      TotalPhase,
+      NumPhases
+      };
+
+   class Histogram
+      {
+   public:
+      static const uint32_t SUB_BUCKET_BITS = 2;
+      static const uint32_t MAX_EXPONENT = 31; // larger values (in usec) go in the last bucket
+      static const uint32_t NUM_BUCKETS = (MAX_EXPONENT - SUB_BUCKET_BITS + 2) << SUB_BUCKET_BITS;
+
+      void add(uint64_t value);
+      uint64_t getCount() const { return _count; }
+      uint64_t getTotal() const { return _total; }
+      uint64_t getMax() const { return _max; }
+      /**
+       * @brief Returns the lower bound of the bucket holding the given percentile
+       */
+      uint64_t getPercentile(uint32_t percentile) const;
+
+      static uint32_t bucketIndex(uint64_t value);
+      static uint64_t bucketLowerBound(uint32_t index);
+
+   private:
+      uint64_t _count;
+      uint64_t _total;
+      uint64_t _max;
+      uint64_t _buckets[NUM_BUCKETS];
+      };
+
+   struct OptimizationStats
+      {
+      uint64_t _count;
+      uint64_t _total; // usec
+      uint64_t _max;   // usec
+      };
+
+   TR_CompilationPhaseStatistics();
+
+   /**
+    * @brief Adds the phase times of a successful compilation
+    * @param optLevel The opt level of the compilation
+    * @param timer The phase timer of the compilation (must be stopped)
+    * @param resolution Resolution of the high resolution clock, in ticks per second
+    */
+   void recordCompilation(TR_Hotness optLevel, const TR_CompilationPhaseTimer &timer, uint64_t resolution);
+   void recordRelocation(TR_Hotness optLevel, uint64_t usec);
+
+   void print(FILE *file) const;
+   /**
+    * @brief Prints the statistics into the given buffer, truncating the output if needed
+    * @return The length of the complete output, excluding the terminating NUL character
+    */
+   size_t print(char *buffer, size_t bufferSize) const;
+
+   static const char *getPhaseName(Phase phase);
+
+private:
+   class Output
+      {
+   public:
+      Output(FILE *file) : _file(file), _buffer(NULL), _bufferSize(0), _length(0) {}
+      Output(char *buffer, size_t bufferSize) : _file(NULL), _buffer(buffer), _bufferSize(bufferSize), _length(0) {}
+      void printf(const char *format, ...);
+      size_t getLength() const { return _length; }
+   private:
+      FILE   *_file;
+      char   *_buffer;
+      size_t  _bufferSize;
+      size_t  _length;
+      };
+
+   void print(Output &out) const;
+
+   TR::Monitor      *_monitor;
+   Histogram         _histograms[numHotnessLevels][NumPhases];
+   OptimizationStats _optimizationStats[numHotnessLevels][OMR::numOpts];
+   };
+
+#endif // COMPILATIONPHASESTATISTICS_HPP
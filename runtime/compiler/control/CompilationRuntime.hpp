@@ -64,6 +64,8 @@ class TR_HWProfiler;
 class TR_J9VMBase;
 class TR_LowPriorityCompQueue;
 class TR_OptimizationPlan;
+class TR_WarmRestartPlan;
+class TR_CompilationPhaseStatistics;
 class TR_PersistentMethodInfo;
 class TR_RelocationRuntime;
 class TR_ResolvedMethod;
@@ -78,6 +80,7 @@ typedef J9JITExceptionTable TR_MethodMetaData;
 #if defined(J9VM_OPT_JITSERVER)
 class ClientSessionHT;
 class JITServerSharedROMClassCache;
+class JITServerAOTCache;
 #endif /* defined(J9VM_OPT_JITSERVER) */
 
 struct TR_SignatureCountPair
@@ -691,6 +694,7 @@ public:
    void                   recycleCompilationEntry(TR_MethodToBeCompiled *cur);
 #if defined(J9VM_OPT_JITSERVER)
    void                   requeueOutOfProcessEntry(TR_MethodToBeCompiled *entry);
+   TR_MethodToBeCompiled *getNextOutOfProcessEntry(TR::CompilationInfoPerThread *compInfoPT);
 #endif /* defined(J9VM_OPT_JITSERVER) */
    TR_MethodToBeCompiled *adjustCompilationEntryAndRequeue(TR::IlGeneratorMethodDetails &details,
                                                            TR_PersistentMethodInfo *methodInfo,
@@ -1007,6 +1011,29 @@ public:
    uint64_t computeAndCacheFreePhysicalMemory(bool &incompleteInfo, int64_t updatePeriodMs=-1);
    uint64_t computeFreePhysicalLimitAndAbortCompilationIfLow(TR::Compilation *comp, bool &incompleteInfo, size_t sizeToAllocate);
 
+   /**
+   * @brief Estimate the scratch memory a compilation will use based on the
+   *        footprint of previous compilations of similar size at the same opt level
+   *
+   * @param optLevel       Optimization level of the compilation
+   * @param bytecodeSize   Bytecode size of the method to be compiled
+   * @return               Expected scratch memory usage in bytes
+   */
+   uint64_t estimateScratchMemoryUsage(TR_Hotness optLevel, uint32_t bytecodeSize) const;
+   void recordScratchMemoryUsage(TR_Hotness optLevel, uint32_t bytecodeSize, uint64_t bytes);
+   /**
+   * @brief Admission control for local compilations: downgrade the compilation if
+   *        its expected scratch memory footprint does not fit in the physical memory
+   *        left after accounting for the compilations in progress, then reserve that footprint.
+   *        Acquires the compilation monitor.
+   */
+   void reserveScratchMemory(TR_MethodToBeCompiled *entry);
+   void releaseScratchMemoryReservation(TR_MethodToBeCompiled *entry); // needs compilation monitor in hand
+   uint64_t getScratchMemoryReserved() const { return _scratchMemoryReservedB; }
+
+   TR_CompilationPhaseStatistics *getCompilationPhaseStatistics() const { return _compilationPhaseStatistics; }
+   void setCompilationPhaseStatistics(TR_CompilationPhaseStatistics *stats) { _compilationPhaseStatistics = stats; }
+
    TR_LowPriorityCompQueue &getLowPriorityCompQueue() { return _lowPriorityCompilationScheduler; }
    bool canProcessLowPriorityRequest();
    TR_CompilationErrorCode scheduleLPQAndBumpCount(TR::IlGeneratorMethodDetails &details, TR_J9VMBase *fe);
@@ -1016,6 +1043,9 @@ public:
    TR_JitSampleInfo &getJitSampleInfoRef() { return _jitSampleInfo; }
    TR_InterpreterSamplingTracking *getInterpSamplTrackingInfo() const { return _interpSamplTrackingInfo; }
 
+   TR_WarmRestartPlan *getWarmRestartPlan() const { return _warmRestartPlan; }
+   void setWarmRestartPlan(TR_WarmRestartPlan *plan) { _warmRestartPlan = plan; }
+
    int32_t getAppSleepNano() const { return _appSleepNano; }
    void setAppSleepNano(int32_t t) { _appSleepNano = t; }
    int32_t computeAppSleepNano() const;
@@ -1052,6 +1082,13 @@ public:
    uint32_t incCompReqSeqNo() { return ++_compReqSeqNo; }
    uint32_t getLastCriticalSeqNo() const { return _lastCriticalCompReqSeqNo; }
    void setLastCriticalSeqNo(uint32_t seqNo) { _lastCriticalCompReqSeqNo = seqNo; }
+   // Remember the most recent critical updates sent to the server, so that the server can recover the
+   // updates of requests that never reached it instead of clearing all the caches of this client
+   void logCriticalUpdate(uint32_t seqNo, const std::vector<TR_OpaqueClassBlock*> &unloadedClasses,
+                          const std::vector<TR_OpaqueClassBlock*> &illegalModificationList,
+                          const std::pair<std::string, std::string> &chtableUpdates);
+   // Returns false if some of the updates in (fromSeqNo, toSeqNo] are no longer in the log
+   bool getCriticalUpdates(uint32_t fromSeqNo, uint32_t toSeqNo, std::vector<JITServerHelpers::CriticalUpdate> &updates);
 
    void markCHTableUpdateDone(uint8_t threadId) { _chTableUpdateFlags |= (1 << threadId); }
    void resetCHTableUpdateDone(uint8_t threadId) { _chTableUpdateFlags &= ~(1 << threadId); }
@@ -1071,6 +1108,8 @@ public:
 
    JITServerSharedROMClassCache *getJITServerSharedROMClassCache() const { return _sharedROMClassCache; }
    void setJITServerSharedROMClassCache(JITServerSharedROMClassCache *cache) { _sharedROMClassCache = cache; }
+   JITServerAOTCache *getJITServerAOTCache() const { return _aotCache; }
+   void setJITServerAOTCache(JITServerAOTCache *cache) { _aotCache = cache; }
 #endif /* defined(J9VM_OPT_JITSERVER) */
 
    static void replenishInvocationCount(J9Method* method, TR::Compilation* comp);
@@ -1128,6 +1167,37 @@ private:
 
    static const size_t DLT_HASHSIZE = 123;
 
+   // The compilation queue is kept sorted by priority; entries are grouped into
+   // buckets delimited by the CompilationPriority values so that enqueueing
+   // is O(1) in the common case of equal-priority requests
+   static const int32_t COMP_QUEUE_NUM_PRIORITY_BUCKETS = 11;
+   static int32_t getCompQueuePriorityBucket(uint16_t priority);
+
+   /**
+    * @brief unlinkQueueEntry detaches the given entry from _methodQueue, keeping the priority buckets consistent
+    * @param prev The entry preceding 'entry' in the queue, or NULL if 'entry' is the head of the queue
+    * @param entry The entry to detach
+    * Note: must be called with the compilation queue monitor in hand
+    */
+   void unlinkQueueEntry(TR_MethodToBeCompiled *prev, TR_MethodToBeCompiled *entry);
+
+   // Queued entries are also indexed by J9Method so that looking up the request for
+   // a given method does not walk the whole compilation queue
+   static const size_t METHOD_QUEUE_INDEX_SIZE = 1021;
+   static size_t getMethodQueueIndexSlot(J9Method *method) { return ((uintptr_t)method >> 3) % METHOD_QUEUE_INDEX_SIZE; }
+
+   /**
+    * @brief findQueuedEntry returns the queued request matching the given method details, or NULL if there is none
+    * Note: must be called with the compilation queue monitor in hand
+    */
+   TR_MethodToBeCompiled *findQueuedEntry(TR::IlGeneratorMethodDetails &details, TR_FrontEnd *fe);
+
+   /**
+    * @brief findQueuedNonDLTEntry returns the queued request for the given method that is not a DLT compilation, or NULL if there is none
+    * Note: must be called with the compilation queue monitor in hand
+    */
+   TR_MethodToBeCompiled *findQueuedNonDLTEntry(J9Method *method);
+
    static TR::CompilationInfo * _compilationRuntime;
 
    static int32_t *_compThreadActivationThresholds;
@@ -1138,6 +1208,11 @@ private:
    TR::CompilationInfoPerThread *_compInfoForDiagnosticCompilationThread; // compinfo for dump compilation thread
    TR::CompilationInfoPerThreadBase *_compInfoForCompOnAppThread; // This is NULL for separate compilation thread
    TR_MethodToBeCompiled *_methodQueue;
+   // Last entry of each priority bucket in _methodQueue (NULL if bucket is empty).
+   // Used by queueEntry to find the insertion point without walking the queue
+   TR_MethodToBeCompiled *_methodQueueBucketTail[COMP_QUEUE_NUM_PRIORITY_BUCKETS];
+   // Queued entries chained by _nextInQueueIndex, hashed on their J9Method (see getMethodQueueIndexSlot)
+   TR_MethodToBeCompiled *_methodQueueIndex[METHOD_QUEUE_INDEX_SIZE];
    TR_MethodToBeCompiled *_methodPool;
    int32_t                _methodPoolSize; // shouldn't this and _methodPool be static?
 
@@ -1267,12 +1342,19 @@ private:
    uint64_t _cachedFreePhysicalMemoryB;
    bool _cachedIncompleteFreePhysicalMemory;
    bool _cgroupMemorySubsystemEnabled; // true when running in container and the memory subsystem is enabled
+   // History of scratch memory usage per opt level and log2 of bytecode size (bytes; 0 means no data)
+   static const int32_t SCRATCH_MEMORY_HISTORY_BUCKETS = 17;
+   static int32_t scratchMemoryHistoryBucket(uint32_t bytecodeSize);
+   uint64_t _scratchMemoryHistory[numHotnessLevels][SCRATCH_MEMORY_HISTORY_BUCKETS];
+   uint64_t _scratchMemoryReservedB; // expected scratch memory footprint of compilations in progress; protected by compMonitor
+   TR_CompilationPhaseStatistics *_compilationPhaseStatistics; // NULL unless -Xjit:enableCompilationPhaseStatistics
    // The following flag is set when the JIT is not allowed to allocate
    // a scratch segment due to low physical memory.
    // It is reset when a compilation thread is suspended, thus possibly
    // freeing scratch segments it holds to
    bool _suspendThreadDueToLowPhysicalMemory;
    TR_InterpreterSamplingTracking *_interpSamplTrackingInfo;
+   TR_WarmRestartPlan *_warmRestartPlan; // NULL unless -Xjit:warmRestartPlan is used with a SCC
 
 #if defined(J9VM_OPT_JITSERVER)
    ClientSessionHT               *_clientSessionHT; // JITServer hashtable that holds session information about JITClients
@@ -1283,6 +1365,9 @@ private:
    TR::Monitor                   *_sequencingMonitor; // Used for ordering outgoing messages at the client
    uint32_t                      _compReqSeqNo; // seqNo for outgoing messages at the client
    uint32_t                      _lastCriticalCompReqSeqNo; // seqNo for last request that carried information that needs to be processed in order
+   static const size_t           CRITICAL_UPDATE_LOG_SIZE = 64;
+   PersistentDeque<JITServerHelpers::CriticalUpdate> _criticalUpdateLog; // protected by _sequencingMonitor
+   uint32_t                      _criticalUpdateLogTrimmedSeqNo; // updates with this seqNo or smaller may be missing from the log
    PersistentUnorderedMap<TR_OpaqueClassBlock*, uint8_t> *_newlyExtendedClasses; // JITServer table of newly extended classes
    uint8_t                       _chTableUpdateFlags;
    uint32_t                      _localGCCounter; // Number of local gc cycles done
@@ -1291,6 +1376,7 @@ private:
    PersistentVector<std::string> _sslCerts;
    JITServer::CompThreadActivationPolicy _activationPolicy;
    JITServerSharedROMClassCache *_sharedROMClassCache;
+   JITServerAOTCache *_aotCache;
 #endif /* defined(J9VM_OPT_JITSERVER) */
    }; // CompilationInfo
 }
@@ -50,11 +50,13 @@
 #include "codegen/PrivateLinkage.hpp"
 #include "compile/CompilationTypes.hpp"
 #include "compile/ResolvedMethod.hpp"
+#include "control/CompilationPhaseStatistics.hpp"
 #include "control/JitDump.hpp"
 #include "control/Recompilation.hpp"
 #include "control/RecompilationInfo.hpp"
 #include "control/MethodToBeCompiled.hpp"
 #include "control/OptimizationPlan.hpp"
+#include "control/WarmRestartPlan.hpp"
 #include "env/CompilerEnv.hpp"
 #include "env/IO.hpp"
 #include "env/PersistentInfo.hpp"
@@ -102,6 +104,7 @@
 #include "control/JITServerCompilationThread.hpp"
 #include "control/JITServerHelpers.hpp"
 #include "runtime/JITClientSession.hpp"
+#include "runtime/Listener.hpp"
 #include "net/ClientStream.hpp"
 #include "net/ServerStream.hpp"
 #include "omrformatconsts.h"
@@ -529,11 +532,12 @@ TR_YesNoMaybe TR::CompilationInfo::shouldActivateNewCompThread()
       if ((getNumCompThreadsActive() + 1) * 100 >= (TR::Options::_compThreadCPUEntitlement + 50))
          return TR_no;
       }
-   // Do not activate if we are low on physical memory
+   // Do not activate if we are low on physical memory. The scratch memory that the
+   // compilations in progress are expected to use is not free for a new thread either.
    bool incompleteInfo;
    uint64_t freePhysicalMemorySizeB = computeAndCacheFreePhysicalMemory(incompleteInfo);
    if (freePhysicalMemorySizeB != OMRPORT_MEMINFO_NOT_AVAILABLE &&
-       freePhysicalMemorySizeB <= (uint64_t)TR::Options::getSafeReservePhysicalMemoryValue() + TR::Options::getScratchSpaceLowerBound())
+       freePhysicalMemorySizeB <= (uint64_t)TR::Options::getSafeReservePhysicalMemoryValue() + TR::Options::getScratchSpaceLowerBound() + _scratchMemoryReservedB)
       return TR_no;
    // Do not activate a new thread during graceperiod if AOT is used and first run because
    // we may have too many warm compilations at warm. However, there is no such risk for quickstart
@@ -1088,6 +1092,7 @@ TR::CompilationInfo::CompilationInfo(J9JITConfig *jitConfig) :
    _sslKeys(decltype(_sslKeys)::allocator_type(TR::Compiler->persistentAllocator())),
    _sslCerts(decltype(_sslCerts)::allocator_type(TR::Compiler->persistentAllocator())),
    _classesCachedAtServer(decltype(_classesCachedAtServer)::allocator_type(TR::Compiler->persistentAllocator())),
+   _criticalUpdateLog(decltype(_criticalUpdateLog)::allocator_type(TR::Compiler->persistentAllocator())),
 #endif /* defined(J9VM_OPT_JITSERVER) */
    _persistentMemory(pointer_cast<TR_PersistentMemory *>(jitConfig->scratchSegment)),
    _sharedCacheReloRuntime(jitConfig),
@@ -1112,6 +1117,9 @@ TR::CompilationInfo::CompilationInfo(J9JITConfig *jitConfig) :
    OMRPORT_ACCESS_FROM_J9PORT(jitConfig->javaVM->portLibrary);
    _cgroupMemorySubsystemEnabled = (OMR_CGROUP_SUBSYSTEM_MEMORY == omrsysinfo_cgroup_are_subsystems_enabled(OMR_CGROUP_SUBSYSTEM_MEMORY));
    _suspendThreadDueToLowPhysicalMemory = false;
+   memset(_scratchMemoryHistory, 0, sizeof(_scratchMemoryHistory));
+   _scratchMemoryReservedB = 0;
+   _compilationPhaseStatistics = NULL; // This will be set later, once options are processed
 
    // Initialize the compilation monitor
    //
@@ -1182,6 +1190,7 @@ TR::CompilationInfo::CompilationInfo(J9JITConfig *jitConfig) :
    _lowPriorityCompilationScheduler.setCompInfo(this);
    _JProfilingQueue.setCompInfo(this);
    _interpSamplTrackingInfo = new (PERSISTENT_NEW) TR_InterpreterSamplingTracking(this);
+   _warmRestartPlan = NULL; // This will be set later, once the SCC is validated
 #if defined(J9VM_OPT_JITSERVER)
    _clientSessionHT = NULL; // This will be set later when options are processed
    _unloadedClassesTempList = NULL;
@@ -1190,10 +1199,12 @@ TR::CompilationInfo::CompilationInfo(J9JITConfig *jitConfig) :
    _sequencingMonitor = TR::Monitor::create("JIT-SequencingMonitor");
    _classesCachedAtServerMonitor = TR::Monitor::create("JIT-ClassesCachedAtServerMonitor");
    _compReqSeqNo = 0;
+   _criticalUpdateLogTrimmedSeqNo = 0;
    _chTableUpdateFlags = 0;
    _localGCCounter = 0;
    _activationPolicy = JITServer::CompThreadActivationPolicy::AGGRESSIVE;
    _sharedROMClassCache = NULL;
+   _aotCache = NULL;
 #endif /* defined(J9VM_OPT_JITSERVER) */
    }
 
@@ -1983,10 +1994,7 @@ void TR::CompilationInfo::invalidateRequestsForNativeMethods(J9Class * clazz, J9
             }
 
          // detach from queue
-         if (prev)
-            prev->_next = cur->_next;
-         else
-            _methodQueue = cur->_next;
+         unlinkQueueEntry(prev, cur);
          updateCompQueueAccountingOnDequeue(cur);
          // decrease the queue weight
          decreaseQueueWeightBy(cur->_weight);
@@ -2094,10 +2102,7 @@ void TR::CompilationInfo::invalidateRequestsForUnloadedMethods(TR_OpaqueClassBlo
                   }
                }
             // detach from queue
-            if (prev)
-               prev->_next = cur->_next;
-            else
-               _methodQueue = cur->_next;
+            unlinkQueueEntry(prev, cur);
             updateCompQueueAccountingOnDequeue(cur);
             // decrease the queue weight
             decreaseQueueWeightBy(cur->_weight);
@@ -2414,7 +2419,7 @@ void TR::CompilationInfo::purgeMethodQueue(TR_CompilationErrorCode errorCode)
    while (_methodQueue)
       {
       TR_MethodToBeCompiled * cur = _methodQueue;
-      _methodQueue = cur->_next;
+      unlinkQueueEntry(NULL, cur);
       updateCompQueueAccountingOnDequeue(cur);
       // decrease the queue weight
       decreaseQueueWeightBy(cur->_weight);
@@ -3146,6 +3151,9 @@ void TR::CompilationInfo::stopCompilationThreads()
       return;
       }
 
+   if (getCompilationPhaseStatistics())
+      getCompilationPhaseStatistics()->print(stderr);
+
    static char * printCompStats = feGetEnv("TR_PrintCompStats");
    if (printCompStats)
       {
@@ -4661,8 +4669,6 @@ TR::CompilationInfo::addMethodToBeCompiled(TR::IlGeneratorMethodDetails & detail
 
    // Add this method to the queue of methods waiting to be compiled.
    TR_MethodToBeCompiled *cur = NULL, *prev = NULL;
-   uint32_t queueWeight = 0; // QW
-   int32_t numEntries = 0;
 
    // See if the method is already in the queue or is already being compiled
    //
@@ -4678,7 +4684,6 @@ TR::CompilationInfo::addMethodToBeCompiled(TR::IlGeneratorMethodDetails & detail
       TR_MethodToBeCompiled *compMethod = curCompThreadInfoPT->getMethodBeingCompiled();
       if (compMethod)
          {
-         queueWeight += compMethod->_weight; // QW
          if (compMethod->getMethodDetails().sameAs(details, fe))
             {
             if (!compMethod->_unloadedMethod) // Redefinition; see cmvc 192606 and RTC 36898
@@ -4693,13 +4698,8 @@ TR::CompilationInfo::addMethodToBeCompiled(TR::IlGeneratorMethodDetails & detail
          }
       }
 
-   for (prev = NULL, cur = _methodQueue; cur; prev = cur, cur = cur->_next)
-      {
-      numEntries++;
-      queueWeight += cur->_weight;
-      if (cur->getMethodDetails().sameAs(details, fe))
-         break;
-      }
+   cur = findQueuedEntry(details, fe);
+   prev = cur ? cur->_prev : NULL;
 
    // NOTE: we do not need to search the methodPool since we cannot reach here if an entry
    // for the compilation of this method is already in the pool.  Things are put in the pool
@@ -4718,10 +4718,17 @@ TR::CompilationInfo::addMethodToBeCompiled(TR::IlGeneratorMethodDetails & detail
       if (pc)
          cur->_oldStartPC = pc;
 
-      // If the priority has increased, use the new priority
+      // If the priority has increased, use the new priority.
+      // The entry must be taken out of the queue before its priority
+      // changes, and then re-inserted at its new position
       //
+      bool mustReposition = false;
       if (cur->_priority < priority)
+         {
+         unlinkQueueEntry(prev, cur);
          cur->_priority = priority;
+         mustReposition = true;
+         }
       // If the optimization level is higher, just upgrade
       // (unless the methods has excessive complexity)
       //
@@ -4738,18 +4745,29 @@ TR::CompilationInfo::addMethodToBeCompiled(TR::IlGeneratorMethodDetails & detail
          }
       // If the position in the queue is still correct, just return
       //
-      if (!prev || prev->_priority >= cur->_priority)
+      if (!mustReposition)
          return cur;
-
-      // Must re-position in the queue
-      //
-      prev->_next = cur->_next; // take it out of the queue
       }
 
    // If method is not yet in the queue prepare the queue entry
    //
    else
       {
+#ifdef DEBUG
+      // Cross-check the queue accounting, which is maintained incrementally
+      uint32_t queueWeight = 0; // QW
+      int32_t numEntries = 0;
+      for (uint8_t i = 0; i < getNumTotalCompilationThreads(); i++)
+         {
+         TR_MethodToBeCompiled *compMethod = _arrayOfCompilationInfoPerThread[i]->getMethodBeingCompiled();
+         if (compMethod)
+            queueWeight += compMethod->_weight;
+         }
+      for (TR_MethodToBeCompiled *entry = _methodQueue; entry; entry = entry->_next)
+         {
+         numEntries++;
+         queueWeight += entry->_weight;
+         }
       if (queueWeight != _queueWeight) //QW
          {
          if (TR::Options::isAnyVerboseOptionSet())
@@ -4763,6 +4781,7 @@ TR::CompilationInfo::addMethodToBeCompiled(TR::IlGeneratorMethodDetails & detail
             TR_VerboseLog::writeLineLocked(TR_Vlog_INFO, "Discrepancy for queue size while adding to queue: Before adding numEntries=%d  _numQueuedMethods=%d\n", numEntries, _numQueuedMethods);
          TR_ASSERT(false, "Discrepancy for queue size while adding to queue");
          }
+#endif
 
       cur = getCompilationQueueEntry();
       if (cur == NULL)  // Memory Allocation Failure.
@@ -4941,9 +4960,39 @@ TR::CompilationInfo::addMethodToBeCompiled(TR::IlGeneratorMethodDetails & detail
    return cur;
    }
 
+//----------------------- getCompQueuePriorityBucket ----------------------
+// Map a compilation priority to its bucket in the compilation queue.
+// Bucket 0 holds the highest priorities. Each bucket covers the priorities
+// between two consecutive CompilationPriority values
+//------------------------------------------------------------------------
+int32_t TR::CompilationInfo::getCompQueuePriorityBucket(uint16_t priority)
+   {
+   static const uint16_t bucketLowerBounds[COMP_QUEUE_NUM_PRIORITY_BUCKETS] =
+      {
+      CP_MAX,
+      CP_SYNC_BELOW_MAX,
+      CP_SYNC_NORMAL,
+      CP_SYNC_MIN,
+      CP_ASYNC_MAX,
+      CP_ASYNC_BELOW_MAX,
+      CP_ASYNC_ABOVE_NORMAL,
+      CP_ASYNC_NORMAL,
+      CP_ASYNC_BELOW_NORMAL,
+      CP_ASYNC_ABOVE_MIN,
+      0
+      };
+   int32_t bucket = 0;
+   while (priority < bucketLowerBounds[bucket])
+      bucket++;
+   return bucket;
+   }
+
 //--------------------------- queueEntry ---------------------------------
 // Insert the compilation request in the queue at the appropriate place
-// based on its priority. Must have compilationQueueMonitor in hanb
+// based on its priority. Must have compilationQueueMonitor in hand.
+// The tail of the priority bucket of the entry is used as insertion point;
+// only when the bucket contains entries of different priorities do we
+// need to walk (the bucket part of) the queue
 //------------------------------------------------------------------------
 void TR::CompilationInfo::queueEntry(TR_MethodToBeCompiled *entry)
    {
@@ -4951,25 +5000,100 @@ void TR::CompilationInfo::queueEntry(TR_MethodToBeCompiled *entry)
 
    entry->_freeTag |= ENTRY_QUEUED;
 
-   if (!_methodQueue || _methodQueue->_priority < entry->_priority)
+   int32_t bucket = getCompQueuePriorityBucket(entry->_priority);
+   TR_MethodToBeCompiled *prev = _methodQueueBucketTail[bucket];
+   if (!prev || prev->_priority < entry->_priority)
+      {
+      // Start from the tail of the closest higher priority bucket which is not empty
+      prev = NULL;
+      for (int32_t b = bucket - 1; b >= 0 && !prev; b--)
+         prev = _methodQueueBucketTail[b];
+      // Skip the entries of my bucket that have a priority greater or equal to mine
+      TR_MethodToBeCompiled *next = prev ? prev->_next : _methodQueue;
+      while (next && next->_priority >= entry->_priority)
+         {
+         prev = next;
+         next = next->_next;
+         }
+      }
+
+   if (prev)
+      {
+      entry->_next = prev->_next;
+      prev->_next = entry;
+      }
+   else
       {
       entry->_next = _methodQueue;
       _methodQueue = entry;
       }
+   entry->_prev = prev;
+   if (entry->_next)
+      entry->_next->_prev = entry;
+
+   if (!entry->_next || getCompQueuePriorityBucket(entry->_next->_priority) != bucket)
+      _methodQueueBucketTail[bucket] = entry;
+
+   size_t slot = getMethodQueueIndexSlot(entry->getMethodDetails().getMethod());
+   entry->_nextInQueueIndex = _methodQueueIndex[slot];
+   _methodQueueIndex[slot] = entry;
+   }
+
+//--------------------------- unlinkQueueEntry -----------------------------
+// Detach an entry from the compilation queue. The priority of the entry must
+// not have been changed since it was queued.
+// Must have compilationQueueMonitor in hand
+//------------------------------------------------------------------------
+void TR::CompilationInfo::unlinkQueueEntry(TR_MethodToBeCompiled *prev, TR_MethodToBeCompiled *entry)
+   {
+   TR_ASSERT(prev ? prev->_next == entry : _methodQueue == entry, "unlinkQueueEntry: prev is not the predecessor of entry");
+   TR_ASSERT(prev == entry->_prev, "unlinkQueueEntry: inconsistent back link");
+   if (prev)
+      prev->_next = entry->_next;
    else
-      {
-      for (TR_MethodToBeCompiled *prev = _methodQueue; ; prev = prev->_next)
-         {
-         if (!prev->_next || prev->_next->_priority < entry->_priority)
-            {
-            entry->_next = prev->_next;
-            prev->_next = entry;
-            break;
-            }
-         }
+      _methodQueue = entry->_next;
+   if (entry->_next)
+      entry->_next->_prev = prev;
+   entry->_prev = NULL;
+
+   TR_MethodToBeCompiled **link = &_methodQueueIndex[getMethodQueueIndexSlot(entry->getMethodDetails().getMethod())];
+   while (*link != entry)
+      link = &(*link)->_nextInQueueIndex;
+   *link = entry->_nextInQueueIndex;
+   entry->_nextInQueueIndex = NULL;
+
+   int32_t bucket = getCompQueuePriorityBucket(entry->_priority);
+   if (_methodQueueBucketTail[bucket] == entry)
+      {
+      if (prev && getCompQueuePriorityBucket(prev->_priority) == bucket)
+         _methodQueueBucketTail[bucket] = prev;
+      else
+         _methodQueueBucketTail[bucket] = NULL;
       }
    }
 
+//--------------------------- findQueuedEntry -----------------------------
+// Must have compilationQueueMonitor in hand
+//------------------------------------------------------------------------
+TR_MethodToBeCompiled *TR::CompilationInfo::findQueuedEntry(TR::IlGeneratorMethodDetails &details, TR_FrontEnd *fe)
+   {
+   TR_MethodToBeCompiled *cur = _methodQueueIndex[getMethodQueueIndexSlot(details.getMethod())];
+   while (cur && !cur->getMethodDetails().sameAs(details, fe))
+      cur = cur->_nextInQueueIndex;
+   return cur;
+   }
+
+//------------------------ findQueuedNonDLTEntry --------------------------
+// Must have compilationQueueMonitor in hand
+//------------------------------------------------------------------------
+TR_MethodToBeCompiled *TR::CompilationInfo::findQueuedNonDLTEntry(J9Method *method)
+   {
+   TR_MethodToBeCompiled *cur = _methodQueueIndex[getMethodQueueIndexSlot(method)];
+   while (cur && (cur->isDLTCompile() || cur->getMethodDetails().getMethod() != method))
+      cur = cur->_nextInQueueIndex;
+   return cur;
+   }
+
 //--------------------------------- requeue ----------------------------------
 // Put the request that is currently being compiled, back into the queue
 // and increment the number of queued methods
@@ -5011,12 +5135,8 @@ TR::CompilationInfo::adjustCompilationEntryAndRequeue(
       }
 
    // Search the queue for my method
-   TR_MethodToBeCompiled *cur, *prev;
-   for (prev = NULL, cur = _methodQueue; cur; prev = cur, cur = cur->_next)
-      {
-      if (cur->getMethodDetails().sameAs(details, fe))
-         break;
-      }
+   TR_MethodToBeCompiled *cur = findQueuedEntry(details, fe);
+   TR_MethodToBeCompiled *prev = cur ? cur->_prev : NULL;
    if (cur)
       {
       // here define the list of exclusions
@@ -5036,10 +5156,7 @@ TR::CompilationInfo::adjustCompilationEntryAndRequeue(
          if (cur->_priority < priority)
             {
             // take the method out
-            if (prev)
-               prev->_next = cur->_next;
-            else
-               _methodQueue = cur->_next;
+            unlinkQueueEntry(prev, cur);
             // put it back at its proper place
             cur->_priority = priority;
             queueEntry(cur);
@@ -5068,44 +5185,23 @@ int32_t TR::CompilationInfo::promoteMethodInAsyncQueue(J9Method * method, void *
          }
       }
 
-   int i = 0;
-   TR_MethodToBeCompiled *cur, *prev;
-   for (prev = NULL, cur = _methodQueue; cur; prev = cur, cur = cur->_next)
-      {
-      if (!cur->isDLTCompile() && method == cur->getMethodDetails().getMethod())
-         break;
-      i++;
-      }
+   TR_MethodToBeCompiled *cur = findQueuedNonDLTEntry(method);
+   TR_MethodToBeCompiled *prev = cur ? cur->_prev : NULL;
 
    if (!cur || !prev || cur->_priority >= CP_ASYNC_MAX || prev->_priority >= CP_ASYNC_MAX)
-      return -i;
+      return -1;
    changeCompThreadPriority(J9THREAD_PRIORITY_MAX, 9);
    _statNumQueuePromotions++;
 #ifdef STATS
    fprintf(stderr, "Promoting method in queue QSZ=%d\n", getMethodQueueSize());
 #endif
-   cur->_priority = CP_ASYNC_MAX;
-
    // take the method out
-   prev->_next = cur->_next;
-   // find insertion point
-   if (_methodQueue->_priority < CP_ASYNC_MAX) // common case
-      {
-      cur->_next = _methodQueue;
-      _methodQueue = cur;
-      // FIXME: how about the compilation lag
-      }
-   else
-      {
-      for (prev = _methodQueue; prev->_next; prev = prev->_next)
-         if (prev->_next->_priority < CP_ASYNC_MAX)
-            {
-            cur->_next = prev->_next;
-            prev->_next = cur;
-            break;
-            }
-      }
-   return i;
+   unlinkQueueEntry(prev, cur);
+   // put it back after all the requests with priority CP_ASYNC_MAX or higher
+   // FIXME: how about the compilation lag
+   cur->_priority = CP_ASYNC_MAX;
+   queueEntry(cur);
+   return 1;
    }
 
 void TR::CompilationInfo::changeCompReqFromAsyncToSync(J9Method * method)
@@ -5133,25 +5229,18 @@ void TR::CompilationInfo::changeCompReqFromAsyncToSync(J9Method * method)
       }
    if (!cur)
       {
-      for (cur = _methodQueue; cur; prev = cur, cur = cur->_next)
-         if (!cur->isDLTCompile() && method == cur->getMethodDetails().getMethod())
-            break;
+      cur = findQueuedNonDLTEntry(method);
+      prev = cur ? cur->_prev : NULL;
       // Check if this is an asynchronous request
       //
       if (cur && cur->_priority <= CP_ASYNC_MAX)
          {
-         // Take the method out, increase its priority and insert it at the proper place
+         // Take the method out, increase its priority and insert it at the proper place.
+         // If the method is already at the top of the queue, it will be re-inserted there
          //
+         unlinkQueueEntry(prev, cur);
          cur->_priority = CP_SYNC_NORMAL;
-         if (prev)
-            {
-            prev->_next = cur->_next;
-            queueEntry(cur);
-            }
-         else // method already at the top of the queue
-            {
-            // Nothing to do
-            }
+         queueEntry(cur);
          }
       else
          {
@@ -5243,7 +5332,7 @@ TR::CompilationInfo::getNextMethodToBeCompiled(TR::CompilationInfoPerThread *com
       if (_methodQueue)
          {
          nextMethodToBeCompiled = _methodQueue;
-         _methodQueue = _methodQueue->_next;
+         unlinkQueueEntry(NULL, nextMethodToBeCompiled);
 
          // See explanation at the start of this function of why it is important to ensure this
          TR_ASSERT_FATAL(nextMethodToBeCompiled->getMethodDetails().isJitDumpMethod(), "Diagnostic thread attempting to process non-JitDump compilation");
@@ -5259,16 +5348,22 @@ TR::CompilationInfo::getNextMethodToBeCompiled(TR::CompilationInfoPerThread *com
       // entries. We prevent it from processing JitDump compilation requests here.
       if (_methodQueue != NULL && !_methodQueue->getMethodDetails().isJitDumpMethod())
          {
+   #if defined(J9VM_OPT_JITSERVER)
+         if (getPersistentInfo()->getRemoteCompilationMode() == JITServer::SERVER)
+            {
+            // Compile right away in server mode, but share the compilation threads fairly among clients
+            nextMethodToBeCompiled = getNextOutOfProcessEntry(compInfoPT);
+            if (!nextMethodToBeCompiled) // all queued requests belong to clients that reached their limit
+               *compThreadAction = GO_TO_SLEEP_CONCURRENT_EXPENSIVE_REQUESTS;
+            }
+         else
+   #endif /* defined(J9VM_OPT_JITSERVER) */
          // If the request is sync or AOT load, take it now
          if (_methodQueue->_priority >= CP_SYNC_MIN // sync comp
-            || _methodQueue->_methodIsInSharedCache == TR_yes // very cheap relocation
-   #if defined(J9VM_OPT_JITSERVER)
-            || getPersistentInfo()->getRemoteCompilationMode() == JITServer::SERVER // compile right away in server mode
-   #endif
-            )
+            || _methodQueue->_methodIsInSharedCache == TR_yes) // very cheap relocation
             {
             nextMethodToBeCompiled = _methodQueue;
-            _methodQueue = _methodQueue->_next;
+            unlinkQueueEntry(NULL, nextMethodToBeCompiled);
             }
          // Check if we need to throttle
          else if (exceedsCompCpuEntitlement() == TR_yes &&
@@ -5287,7 +5382,7 @@ TR::CompilationInfo::getNextMethodToBeCompiled(TR::CompilationInfoPerThread *com
                   _methodQueue->_weight < TR::Options::_expensiveCompWeight) // This is a cheaper comp
             {
             nextMethodToBeCompiled = _methodQueue;
-            _methodQueue = _methodQueue->_next;
+            unlinkQueueEntry(NULL, nextMethodToBeCompiled);
             }
          else // scan for a cold/warm method
             {
@@ -5298,7 +5393,7 @@ TR::CompilationInfo::getNextMethodToBeCompiled(TR::CompilationInfoPerThread *com
                   nextMethodToBeCompiled->_priority >= CP_SYNC_MIN ||       // sync comp
                   nextMethodToBeCompiled->_methodIsInSharedCache == TR_yes) // very cheap relocation
                   {
-                  prev->_next = nextMethodToBeCompiled->_next;
+                  unlinkQueueEntry(prev, nextMethodToBeCompiled);
                   break;
                   }
                }
@@ -6213,20 +6308,12 @@ void *TR::CompilationInfo::compileOnSeparateThread(J9VMThread * vmThread, TR::Il
          changeCompReqFromAsyncToSync(method);
       else
          {
-         TR_MethodToBeCompiled *reqMe, *prevReq;
-         for (prevReq=NULL, reqMe=_methodQueue; reqMe; prevReq = reqMe, reqMe = reqMe->_next)
-            {
-            if (!reqMe->isDLTCompile() && reqMe->getMethodDetails().getMethod() == method)
-               break;
-            }
+         TR_MethodToBeCompiled *reqMe = findQueuedNonDLTEntry(method);
          if (reqMe && reqMe->_priority<CP_ASYNC_ABOVE_NORMAL)
             {
+            unlinkQueueEntry(reqMe->_prev, reqMe);
             reqMe->_priority = CP_ASYNC_ABOVE_NORMAL;
-            if (prevReq && prevReq->_priority<CP_ASYNC_ABOVE_NORMAL)
-               {
-               prevReq->_next = reqMe->_next;
-               queueEntry(reqMe);
-               }
+            queueEntry(reqMe);
             }
          }
       }
@@ -6724,6 +6811,16 @@ TR::CompilationInfoPerThreadBase::installAotCachedMethod(
          TR_VerboseLog::vlogRelease();
          }
 
+      if (_compInfo.getCompilationPhaseStatistics())
+         {
+         if (reloTime == 0)
+            {
+            PORT_ACCESS_FROM_JITCONFIG(_jitConfig);
+            reloTime = j9time_usec_clock() - reloRuntime()->reloStartTime();
+            }
+         _compInfo.getCompilationPhaseStatistics()->recordRelocation(compiler->getMethodHotness(), reloTime);
+         }
+
 #if defined(TR_HOST_S390)
       if (TR::Options::getVerboseOption(TR_VerboseMMap))
          {
@@ -7942,6 +8039,10 @@ TR::CompilationInfoPerThreadBase::compile(J9VMThread * vmThread,
                           canDoRelocatableCompile, eligibleForRelocatableCompile,
                           reloRuntime);
 
+      // Now that we know whether this is a local compilation, check that its
+      // expected scratch memory footprint fits in the available physical memory
+      _compInfo.reserveScratchMemory(entry);
+
       CompileParameters compParam(
          this,
          _vm,
@@ -8001,6 +8102,15 @@ TR::CompilationInfoPerThreadBase::compile(J9VMThread * vmThread,
             }
 
          metaData = (protectedResult == 0) ? reinterpret_cast<TR_MethodMetaData *>(result) : NULL;
+
+         // Learn the scratch memory footprint of successful compilations for admission control
+         if (metaData && entry->_scratchMemoryReservation &&
+             !TR::Options::getCmdLineOptions()->getOption(TR_EnableScratchMemoryDebugging))
+            {
+            _compInfo.recordScratchMemoryUsage(entry->_optimizationPlan->getOptLevel(),
+                                               TR::CompilationInfo::getMethodBytecodeSize(method),
+                                               defaultSegmentProvider.systemBytesAllocated());
+            }
          }
       else
          {
@@ -8055,6 +8165,10 @@ TR::CompilationInfoPerThreadBase::compile(J9VMThread * vmThread,
       }
 
 
+   // postCompilationTasks returns with the compilation monitor in hand for local compilations
+   if (entry->_scratchMemoryReservation)
+      _compInfo.releaseScratchMemoryReservation(entry);
+
    vmThread->omrVMThread->vmState = oldState;
    vmThread->jitMethodToBeCompiled = NULL;
 
@@ -8469,6 +8583,11 @@ TR::CompilationInfoPerThreadBase::wrappedCompile(J9PortLibrary *portLib, void *
                         methodInfo->incrementNumberOfInlinedMethodRedefinition();
                      if (methodInfo->getNumberOfInlinedMethodRedefinition() >= 2)
                         options->setOption(TR_DisableNextGenHCR);
+                     // If preexistence assumptions keep getting violated for this method, stop speculating
+                     // on preexistence rather than recompiling in a loop. Bodies invalidated for other reasons
+                     // (e.g. class redefinition) are not counted, so HCR does not turn preexistence off
+                     if (methodInfo->getNumberOfPreexistenceInvalidations() >= 2)
+                        options->setDisabled(OMR::invariantArgumentPreexistence, true);
                      }
                   }
 
@@ -8985,6 +9104,10 @@ TR::CompilationInfoPerThreadBase::wrappedCompile(J9PortLibrary *portLib, void *
                // In subsequent runs we should give such method lower counts the idea being
                // that if I take the time to compile method, why not do it sooner
                sc->addHint(method, TR_HintMethodCompiledDuringStartup);
+
+               TR_WarmRestartPlan *warmRestartPlan = that->getCompilationInfo()->getWarmRestartPlan();
+               if (warmRestartPlan && warmRestartPlan->isRecording() && that->_methodBeingCompiled->getMethodDetails().isOrdinaryMethod())
+                  warmRestartPlan->recordCompilation(vmThread, method, hotness, that->_methodBeingCompiled->_oldStartPC != 0);
                }
             }
 
@@ -9441,6 +9564,14 @@ TR::CompilationInfoPerThreadBase::compile(
 
          rtn = compiler->compile();
 
+         TR_CompilationPhaseTimer *phaseTimer = compiler->getCompilationPhaseTimer();
+         if (phaseTimer && !rtn && _compInfo.getCompilationPhaseStatistics())
+            {
+            phaseTimer->stop(TR::Compiler->vm.getHighResClock(compiler));
+            _compInfo.getCompilationPhaseStatistics()->recordCompilation(compiler->getMethodHotness(), *phaseTimer,
+                                                                          TR::Compiler->vm.getHighResClockResolution());
+            }
+
          if (TR::Options::getVerboseOption(TR_VerboseCompilationDispatch) && !rtn)
             {
             TR_VerboseLog::writeLineLocked(
@@ -11861,6 +11992,104 @@ TR::CompilationInfo::computeFreePhysicalLimitAndAbortCompilationIfLow(TR::Compil
    return freePhysicalMemorySizeB;
    }
 
+int32_t
+TR::CompilationInfo::scratchMemoryHistoryBucket(uint32_t bytecodeSize)
+   {
+   int32_t bucket = 0;
+   while (bytecodeSize > 1 && bucket < SCRATCH_MEMORY_HISTORY_BUCKETS - 1)
+      {
+      bytecodeSize >>= 1;
+      bucket++;
+      }
+   return bucket;
+   }
+
+uint64_t
+TR::CompilationInfo::estimateScratchMemoryUsage(TR_Hotness optLevel, uint32_t bytecodeSize) const
+   {
+   if (optLevel < noOpt || optLevel >= numHotnessLevels)
+      return TR::Options::getScratchSpaceLowerBound();
+   uint64_t estimate = _scratchMemoryHistory[optLevel][scratchMemoryHistoryBucket(bytecodeSize)];
+   // Without any history assume the compilation needs the minimum amount of scratch memory we require
+   return estimate ? estimate : TR::Options::getScratchSpaceLowerBound();
+   }
+
+// The history is a moving average that follows increases immediately, to err on the side
+// of overestimating the footprint. Synchronization issues can be ignored here.
+void
+TR::CompilationInfo::recordScratchMemoryUsage(TR_Hotness optLevel, uint32_t bytecodeSize, uint64_t bytes)
+   {
+   if (optLevel < noOpt || optLevel >= numHotnessLevels)
+      return;
+   uint64_t &estimate = _scratchMemoryHistory[optLevel][scratchMemoryHistoryBucket(bytecodeSize)];
+   if (bytes >= estimate)
+      estimate = bytes;
+   else
+      estimate -= (estimate - bytes) >> 3;
+   }
+
+void
+TR::CompilationInfo::reserveScratchMemory(TR_MethodToBeCompiled *entry)
+   {
+   TR::IlGeneratorMethodDetails &details = entry->getMethodDetails();
+   // Only local JIT compilations of ordinary methods use significant amounts of scratch memory.
+   // At the JITServer the method is not accessible from the server process, so it is not covered.
+   if (!details.isOrdinaryMethod() || entry->isAotLoad() || entry->isJNINative() || entry->isOutOfProcessCompReq()
+#if defined(J9VM_OPT_JITSERVER)
+       || entry->isRemoteCompReq()
+#endif /* defined(J9VM_OPT_JITSERVER) */
+      )
+      return;
+
+   TR_OptimizationPlan *plan = entry->_optimizationPlan;
+   TR_Hotness optLevel = plan->getOptLevel();
+   uint32_t bytecodeSize = getMethodBytecodeSize(details.getMethod());
+   uint64_t estimate = estimateScratchMemoryUsage(optLevel, bytecodeSize);
+
+   OMR::CriticalSection compilationMonitorLock(getCompilationMonitor());
+   bool incompleteInfo;
+   uint64_t freePhysicalMemorySizeB = computeAndCacheFreePhysicalMemory(incompleteInfo);
+   // Downgrade first time compilations that are not expected to fit in memory; use the
+   // same restrictions as the other heuristics that downgrade compilations to cold.
+   // The compilation will be upgraded later if the method is important.
+   if (TR::Options::_scratchMemoryAdmissionControl &&
+       freePhysicalMemorySizeB != OMRPORT_MEMINFO_NOT_AVAILABLE && !incompleteInfo &&
+       !entry->_oldStartPC &&
+       !plan->insertInstrumentation() &&
+       TR::Options::getCmdLineOptions()->allowRecompilation() &&
+       !TR::Options::getCmdLineOptions()->getOption(TR_DontDowngradeToCold))
+      {
+      uint64_t committedB = (uint64_t)TR::Options::getSafeReservePhysicalMemoryValue() + _scratchMemoryReservedB;
+      uint64_t availableB = (freePhysicalMemorySizeB > committedB) ? freePhysicalMemorySizeB - committedB : 0;
+      TR_Hotness newOptLevel = optLevel;
+      while (estimate > availableB && newOptLevel > cold)
+         {
+         newOptLevel = (newOptLevel > warm) ? warm : cold;
+         estimate = estimateScratchMemoryUsage(newOptLevel, bytecodeSize);
+         }
+      if (newOptLevel != optLevel)
+         {
+         plan->setOptLevel(newOptLevel);
+         plan->setOptLevelDowngraded(true);
+         if (TR::Options::getVerboseOption(TR_VerboseCompilationDispatch))
+            TR_VerboseLog::writeLineLocked(TR_Vlog_DISPATCH, "Downgraded j9method=%p from %s to %s: available memory %llu KB expected scratch memory %llu KB",
+               details.getMethod(), TR::Compilation::getHotnessName(optLevel), TR::Compilation::getHotnessName(newOptLevel),
+               (unsigned long long)(availableB >> 10), (unsigned long long)(estimate >> 10));
+         }
+      }
+
+   entry->_scratchMemoryReservation = estimate;
+   _scratchMemoryReservedB += estimate;
+   }
+
+void
+TR::CompilationInfo::releaseScratchMemoryReservation(TR_MethodToBeCompiled *entry)
+   {
+   TR_ASSERT(_scratchMemoryReservedB >= entry->_scratchMemoryReservation, "Scratch memory reservation accounting error");
+   _scratchMemoryReservedB -= entry->_scratchMemoryReservation;
+   entry->_scratchMemoryReservation = 0;
+   }
+
 void
 TR::CompilationInfo::replenishInvocationCount(J9Method* method, TR::Compilation* comp)
    {
@@ -13164,10 +13393,111 @@ TR::CompilationInfo::requeueOutOfProcessEntry(TR_MethodToBeCompiled *entry)
    if (feGetEnv("TR_EnableJITServerPerCompConn"))
       return;
 
-   if (entry->_stream && addOutOfProcessMethodToBeCompiled(entry->_stream))
+   if (!entry->_stream)
+      return;
+
+   // Let the stream wait for its next compilation request in the listener
+   // rather than in a compilation thread blocked on reading from the socket
+   TR_Listener *listener = ((TR_JitPrivateConfig*)(_jitConfig->privateConfig))->listener;
+   if (listener && listener->addIdleStream(entry->_stream))
+      return;
+
+   if (addOutOfProcessMethodToBeCompiled(entry->_stream))
       {
       // successfully queued the new entry, so notify a thread
       getCompilationMonitor()->notifyAll();
       }
    }
+
+// Select the next request to be processed by the JITServer such that clients get
+// shares of the compilation time proportional to their scheduling weights.
+// Among the clients that have not reached the limit of concurrent compilations,
+// the oldest queued request of the client with the lowest virtual start time is chosen.
+// Requests that cannot be attributed to a known client yet (the first request on a new
+// connection) are taken in FIFO order.
+// Returns NULL if all queued requests belong to clients that reached their limit.
+// Must be executed with compilation monitor in hand.
+TR_MethodToBeCompiled *
+TR::CompilationInfo::getNextOutOfProcessEntry(TR::CompilationInfoPerThread *compInfoPT)
+   {
+   ClientSessionHT *clientSessionHT = getClientSessionHT();
+   int32_t maxConcurrentCompilations = TR::Options::_jitserverMaxConcurrentCompilationsPerClient;
+   uint64_t virtualClock = clientSessionHT->getSchedulingVirtualClock();
+   TR_MethodToBeCompiled *bestEntry = NULL;
+   TR_MethodToBeCompiled *bestPrev = NULL;
+   ClientSessionData *bestSession = NULL;
+   uint64_t bestStartTime = UINT64_MAX;
+
+   TR_MethodToBeCompiled *prev = NULL;
+   for (TR_MethodToBeCompiled *cur = _methodQueue; cur; prev = cur, cur = cur->_next)
+      {
+      if (cur->getMethodDetails().isJitDumpMethod())
+         continue;
+
+      ClientSessionData *clientSession = cur->_stream ? clientSessionHT->peekClientSession(cur->getClientUID()) : NULL;
+      if (!clientSession)
+         {
+         bestEntry = cur;
+         bestPrev = prev;
+         bestSession = NULL;
+         break;
+         }
+
+      if (maxConcurrentCompilations > 0 && clientSession->getNumScheduledCompilations() >= maxConcurrentCompilations)
+         continue;
+
+      // Strict comparison keeps the FIFO order among the requests of the same client
+      uint64_t startTime = clientSession->getSchedulingStartTime(virtualClock);
+      if (startTime < bestStartTime)
+         {
+         bestEntry = cur;
+         bestPrev = prev;
+         bestSession = clientSession;
+         bestStartTime = startTime;
+         }
+      }
+
+   if (bestEntry)
+      {
+      unlinkQueueEntry(bestPrev, bestEntry);
+      if (bestSession)
+         {
+         clientSessionHT->advanceSchedulingVirtualClock(bestStartTime);
+         bestSession->recordScheduledCompilation(virtualClock, getPersistentInfo()->getElapsedTime() - bestEntry->_entryTime);
+         // Keep the session alive until the compilation thread is done with this request
+         bestSession->incInUse();
+         }
+      static_cast<TR::CompilationInfoPerThreadRemote *>(compInfoPT)->setScheduledClientSession(bestSession);
+      }
+   return bestEntry;
+   }
+
+void
+TR::CompilationInfo::logCriticalUpdate(uint32_t seqNo, const std::vector<TR_OpaqueClassBlock*> &unloadedClasses,
+                                       const std::vector<TR_OpaqueClassBlock*> &illegalModificationList,
+                                       const std::pair<std::string, std::string> &chtableUpdates)
+   {
+   TR_ASSERT(getSequencingMonitor()->owned_by_self(), "Must hold the sequencing monitor");
+   if (_criticalUpdateLog.size() >= CRITICAL_UPDATE_LOG_SIZE)
+      {
+      _criticalUpdateLogTrimmedSeqNo = std::get<0>(_criticalUpdateLog.front());
+      _criticalUpdateLog.pop_front();
+      }
+   _criticalUpdateLog.emplace_back(seqNo, unloadedClasses, illegalModificationList, chtableUpdates.first, chtableUpdates.second);
+   }
+
+bool
+TR::CompilationInfo::getCriticalUpdates(uint32_t fromSeqNo, uint32_t toSeqNo, std::vector<JITServerHelpers::CriticalUpdate> &updates)
+   {
+   OMR::CriticalSection criticalUpdateLog(getSequencingMonitor());
+   if (fromSeqNo < _criticalUpdateLogTrimmedSeqNo)
+      return false;
+   for (const auto &update : _criticalUpdateLog)
+      {
+      uint32_t seqNo = std::get<0>(update);
+      if ((seqNo > fromSeqNo) && (seqNo <= toSeqNo))
+         updates.push_back(update);
+      }
+   return true;
+   }
 #endif /* defined(J9VM_OPT_JITSERVER) */
@@ -70,6 +70,7 @@
 #include "control/MethodToBeCompiled.hpp"
 #include "control/CompilationRuntime.hpp"
 #include "control/CompilationThread.hpp"
+#include "control/WarmRestartPlan.hpp"
 #include "env/VMJ9.h"
 #include "env/j9method.h"
 #include "env/ut_j9jit.h"
@@ -578,6 +579,12 @@ static void jitHookInitializeSendTarget(J9HookInterface * * hook, UDATA eventNum
 #endif // !J9ZOS390
             }
 #endif // defined(J9VM_INTERP_AOT_COMPILE_SUPPORT) && defined(J9VM_OPT_SHARED_CLASSES) && (defined(TR_HOST_X86) || defined(TR_HOST_POWER) || defined(TR_HOST_S390) || defined(TR_HOST_ARM) || defined(TR_HOST_ARM64))
+
+         // Methods compiled during the startup of a previous run get a small count
+         // so that they are queued for compilation soon after their class is loaded
+         TR_WarmRestartPlan *warmRestartPlan = compInfo->getWarmRestartPlan();
+         if (count == -1 && warmRestartPlan && warmRestartPlan->findFirstCompilation(romMethod))
+            count = TR::Options::_countForMethodsInWarmRestartPlan;
          } // if (TR::Options::sharedClassCache())
       if (count == -1) // count didn't change yet
          {
@@ -2947,6 +2954,12 @@ static bool updateCHTable(J9VMThread * vmThread, J9Class  * cl)
    int32_t classDepth = J9CLASS_DEPTH(cl) - 1;
    if (classDepth >= 0)
       {
+      // Every classGotExtended() call below scans the class extend assumptions under
+      // assumptionTableMutex. Hold the monitor once for the superclass and all the
+      // interfaces so loading a class with a wide hierarchy does not bounce the lock
+      // (the monitor is reentrant, so the nested enters are cheap).
+      OMR::CriticalSection classExtendAssumptions(assumptionTableMutex);
+
       J9Class * superCl = cl->superclasses[classDepth];
       superCl->classDepthAndFlags |= J9AccClassHasBeenOverridden;
 
@@ -4115,6 +4128,10 @@ void JitShutdown(J9JITConfig * jitConfig)
 
    TR::CompilationInfo * compInfo = TR::CompilationInfo::get(jitConfig);
 
+   // Store the startup compilations recorded so far if the plan did not fill up
+   if (compInfo->getWarmRestartPlan())
+      compInfo->getWarmRestartPlan()->persist(vmThread);
+
    TR_HWProfiler *hwProfiler = ((TR_JitPrivateConfig*)(jitConfig->privateConfig))->hwProfiler;
    if (compInfo->getPersistentInfo()->isRuntimeInstrumentationEnabled())
       {
@@ -103,6 +103,10 @@ int32_t J9::Options::_smallMethodBytecodeSizeThresholdForCold = -1; // -1 means
 
 int32_t J9::Options::_countForMethodsCompiledDuringStartup = 10;
 
+bool J9::Options::_useWarmRestartPlan = false;
+int32_t J9::Options::_warmRestartPlanMaxEntries = 10000;
+int32_t J9::Options::_countForMethodsInWarmRestartPlan = 0;
+
 int32_t J9::Options::_countForLoopyBootstrapMethods = -1; // -1 means feature disabled
 int32_t J9::Options::_countForLooplessBootstrapMethods = -1; // -1 means feature disabled
 
@@ -128,6 +132,11 @@ int64_t J9::Options::_oldAgeUnderLowMemory = 1000*60*5; // 5 minute
 int64_t J9::Options::_timeBetweenPurges = 1000*60*1; // 1 minute
 bool J9::Options::_shareROMClasses = false;
 int32_t J9::Options::_sharedROMClassCacheNumPartitions = 16;
+bool J9::Options::_compressJITServerMessages = false;
+int32_t J9::Options::_jitserverAOTCacheMaxSizeKB = 128 * 1024; // 128 MB
+int32_t J9::Options::_jitserverMessageCompressionThreshold = 4096; // bytes
+int32_t J9::Options::_jitserverMaxConcurrentCompilationsPerClient = 0; // 0 means no limit
+int32_t J9::Options::_jitserverSchedulingWeight = 1;
 #endif /* defined(J9VM_OPT_JITSERVER) */
 
 int32_t J9::Options::_interpreterSamplingThreshold = 300;
@@ -152,6 +161,7 @@ int32_t J9::Options::_iprofilerNumOutstandingBuffers = 10;
 int32_t J9::Options::_iprofilerBufferMaxPercentageToDiscard = 0;
 int32_t J9::Options::_iProfilerBufferInterarrivalTimeToExitDeepIdle = 5000; // 5 seconds
 int32_t J9::Options::_iprofilerBufferSize = 1024;
+int32_t J9::Options::_iprofilerPersistenceRefreshInterval = 0; // ms; disabled
 #ifdef TR_HOST_64BIT
 int32_t J9::Options::_iProfilerMemoryConsumptionLimit=32*1024*1024;
 #else
@@ -173,6 +183,7 @@ int32_t J9::Options::_numberOfUserClassesLoaded = 0;
 int32_t J9::Options::_compPriorityQSZThreshold = 200;
 int32_t J9::Options::_numQueuedInvReqToDowngradeOptLevel = 20; // If more than 20 inv req are queued we compiled them at cold
 int32_t J9::Options::_qszThresholdToDowngradeOptLevel = -1; // not yet set
+int32_t J9::Options::_codeCacheUsagePercentToShrinkInlining = 75;
 int32_t J9::Options::_qsziThresholdToDowngradeDuringCLP = 0; // -1 or 0 disables the feature and reverts to old behavior
 int32_t J9::Options::_qszThresholdToDowngradeOptLevelDuringStartup = 100000; // a large number disables the feature
 int32_t J9::Options::_cpuUtilThresholdForStarvation = 25; // 25%
@@ -261,6 +272,8 @@ size_t J9::Options::_scratchSpaceLimitKBWhenLowVirtualMemory = 64*1024; // 64MB;
 int32_t J9::Options::_scratchSpaceFactorWhenJSR292Workload = JSR292_SCRATCH_SPACE_FACTOR;
 int32_t J9::Options::_lowVirtualMemoryMBThreshold = 300; // Used on 32 bit Windows, Linux, 31 bit z/OS, Linux
 int32_t J9::Options::_safeReservePhysicalMemoryValue = 32 << 20;  // 32 MB
+bool J9::Options::_scratchMemoryAdmissionControl = true;
+bool J9::Options::_collectCompilationPhaseStatistics = false;
 
 int32_t J9::Options::_numDLTBufferMatchesToEagerlyIssueCompReq = 8; //a value of 1 or less disables the DLT tracking mechanism
 int32_t J9::Options::_dltPostponeThreshold = 2;
@@ -709,6 +722,9 @@ TR::OptionTable OMR::Options::_feOptions[] = {
    {"clinit",             "D\tforce compilation of <clinit> methods", SET_JITCONFIG_RUNTIME_FLAG(J9JIT_COMPILE_CLINIT) },
    {"code=",              "C<nnn>\tcode cache size, in KB",
         TR::Options::setJitConfigNumericValue, offsetof(J9JITConfig, codeCacheKB), 0, " %d (KB)"},
+   {"codeCacheUsagePercentToShrinkInlining=", "O<nnn>\tpercentage of the code cache in use above which the inliner "
+                                              "budget is reduced. 0 disables the reduction",
+        TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_codeCacheUsagePercentToShrinkInlining, 0, "F%d", NOT_IN_SUBSET},
    {"codepad=",              "C<nnn>\ttotal code cache pad size, in KB",
         TR::Options::setJitConfigNumericValue, offsetof(J9JITConfig, codeCachePadKB), 0, " %d (KB)"},
    {"codetotal=",              "C<nnn>\ttotal code memory limit, in KB",
@@ -732,6 +748,11 @@ TR::OptionTable OMR::Options::_feOptions[] = {
    {"compilationYieldStatsThreshold=", "M<nnn>\tprint stats about compilation yield points if the "
                                        "threshold is exceeded. Default 1000 usec. ",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_compYieldStatsThreshold, 0, "F%d", NOT_IN_SUBSET},
+#if defined(J9VM_OPT_JITSERVER)
+   {"compressJITServerMessages", " \tcompress JITServer messages larger than jitserverMessageCompressionThreshold "
+                                 "if the other side of the connection agrees to it",
+        TR::Options::setStaticBool, (intptr_t)&TR::Options::_compressJITServerMessages, 1, "F", NOT_IN_SUBSET},
+#endif /* defined(J9VM_OPT_JITSERVER) */
    {"compThreadPriority=",    "M<nnn>\tThe priority of the compilation thread. "
                               "Use an integer between 0 and 4. Default is 4 (highest priority)",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_compilationThreadPriorityCode, 0, "F%d", NOT_IN_SUBSET},
@@ -756,8 +777,12 @@ TR::OptionTable OMR::Options::_feOptions[] = {
         TR::Options::setJitConfigNumericValue, offsetof(J9JITConfig, dataCacheTotalKB), 0, " %d (KB)"},
    {"disableIProfilerClassUnloadThreshold=",      "R<nnn>\tNumber of classes that can be unloaded before we disable the IProfiler",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_disableIProfilerClassUnloadThreshold, 0, "F%d", NOT_IN_SUBSET},
+   {"disableScratchMemoryAdmissionControl", "M\tdo not downgrade compilations based on their expected scratch memory footprint",
+        TR::Options::setStaticBool, (intptr_t)&TR::Options::_scratchMemoryAdmissionControl, 0, "F", NOT_IN_SUBSET},
    {"dltPostponeThreshold=",      "M<nnn>\tNumber of dlt attempts inv. count for a method is seen not advancing",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_dltPostponeThreshold, 0, "F%d", NOT_IN_SUBSET },
+   {"enableCompilationPhaseStatistics", "M\tcollect per opt level histograms of the time spent in each compilation phase",
+        TR::Options::setStaticBool, (intptr_t)&TR::Options::_collectCompilationPhaseStatistics, 1, "F", NOT_IN_SUBSET},
    {"exclude=",           "D<xxx>\tdo not compile methods beginning with xxx", TR::Options::limitOption, 1, 0, "P%s"},
    {"expensiveCompWeight=", "M<nnn>\tweight of a comp request to be considered expensive",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_expensiveCompWeight, 0, "F%d", NOT_IN_SUBSET },
@@ -864,12 +889,25 @@ TR::OptionTable OMR::Options::_feOptions[] = {
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_IprofilerOffDivisionFactor, 0, "F%d", NOT_IN_SUBSET},
    {"iprofilerOffSubtractionFactor=", "O<nnn>\tCounts Subtraction factor when IProfiler is Off",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_IprofilerOffSubtractionFactor, 0, "F%d", NOT_IN_SUBSET},
+   {"iprofilerPersistenceRefreshInterval=", "O<nnn>\tinterval in ms at which call-site profiles stored in the shared class cache "
+                                            "are refreshed with better sampled ones. Specify 0 to disable",
+        TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_iprofilerPersistenceRefreshInterval, 0, "F%d", NOT_IN_SUBSET},
    {"iprofilerSamplesBeforeTurningOff=", "O<nnn>\tnumber of interpreter profiling samples "
                                 "needs to be taken after the profiling starts going off to completely turn it off. "
                                 "Specify a very large value to disable this optimization",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_iprofilerSamplesBeforeTurningOff, 0, "P%d", NOT_IN_SUBSET},
    {"itFileNamePrefix=",  "L<filename>\tprefix for itrace filename",
         TR::Options::setStringForPrivateBase, offsetof(TR_JitPrivateConfig,itraceFileNamePrefix), 0, "P%s"},
+#if defined(J9VM_OPT_JITSERVER)
+   {"jitserverAOTCacheMaxSizeKB=", " \tmaximum amount of memory in KB used by the JITServer cache of AOT compiled methods",
+        TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_jitserverAOTCacheMaxSizeKB, 0, "F%d", NOT_IN_SUBSET},
+   {"jitserverMaxConcurrentCompilationsPerClient=", " \tmaximum number of compilations a JITServer performs concurrently for one client (0 means no limit)",
+        TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_jitserverMaxConcurrentCompilationsPerClient, 0, "F%d", NOT_IN_SUBSET},
+   {"jitserverMessageCompressionThreshold=", " \tminimum size in bytes of a JITServer message to be compressed",
+        TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_jitserverMessageCompressionThreshold, 0, "F%d", NOT_IN_SUBSET},
+   {"jitserverSchedulingWeight=", " \tshare of JITServer compilation time this client is entitled to, relative to other clients",
+        TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_jitserverSchedulingWeight, 0, "F%d", NOT_IN_SUBSET},
+#endif /* defined(J9VM_OPT_JITSERVER) */
    {"jProfilingEnablementSampleThreshold=", "M<nnn>\tNumber of global samples to allow generation of JProfiling bodies",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_jProfilingEnablementSampleThreshold, 0, "F%d", NOT_IN_SUBSET },
    {"kcaoffsets",         "I\tGenerate a header file with offset data for use with KCA", TR::Options::kcaOffsets, 0, 0, "F" },
@@ -1032,6 +1070,12 @@ TR::OptionTable OMR::Options::_feOptions[] = {
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_waitTimeToGCR, 0, "F%d", NOT_IN_SUBSET},
    {"waitTimeToStartIProfiler=",                 "M<nnn>\tTime (ms) spent outside startup needed to start IProfiler if it was off",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_waitTimeToStartIProfiler, 0, "F%d", NOT_IN_SUBSET},
+   {"warmRestartPlan", "O\trecord the compilations performed during startup in the SCC and replay them in subsequent runs",
+        TR::Options::setStaticBool, (intptr_t)&TR::Options::_useWarmRestartPlan, 1, "F", NOT_IN_SUBSET},
+   {"warmRestartPlanCount=", "O<nnn>\tinitial invocation count for methods found in the warm restart plan",
+        TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_countForMethodsInWarmRestartPlan, 0, "F%d", NOT_IN_SUBSET},
+   {"warmRestartPlanMaxEntries=", "O<nnn>\tmaximum number of compilations recorded in the warm restart plan",
+        TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_warmRestartPlanMaxEntries, 0, "F%d", NOT_IN_SUBSET},
    {"weightOfAOTLoad=",              "M<nnn>\tWeight of an AOT load. 0 by default",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_weightOfAOTLoad, 0, "F%d", NOT_IN_SUBSET},
    {"weightOfJSR292=", "M<nnn>\tWeight of an JSR292 compilation. Number between 0 and 255",
@@ -1113,6 +1157,7 @@ static bool JITServerParseCommonOptions(J9JavaVM *vm, TR::CompilationInfo *compI
    const char *xxJITServerSSLRootCertsOption = "-XX:JITServerSSLRootCerts=";
    const char *xxJITServerUseAOTCacheOption = "-XX:+JITServerUseAOTCache";
    const char *xxDisableJITServerUseAOTCacheOption = "-XX:-JITServerUseAOTCache";
+   const char *xxJITServerAOTCacheNameOption = "-XX:JITServerAOTCacheName=";
 
    int32_t xxJITServerPortArgIndex = FIND_ARG_IN_VMARGS(STARTSWITH_MATCH, xxJITServerPortOption, 0);
    int32_t xxJITServerTimeoutArgIndex = FIND_ARG_IN_VMARGS(STARTSWITH_MATCH, xxJITServerTimeoutOption, 0);
@@ -1121,6 +1166,7 @@ static bool JITServerParseCommonOptions(J9JavaVM *vm, TR::CompilationInfo *compI
    int32_t xxJITServerSSLRootCertsArgIndex = FIND_ARG_IN_VMARGS(STARTSWITH_MATCH, xxJITServerSSLRootCertsOption, 0);
    int32_t xxJITServerUseAOTCacheArgIndex = FIND_ARG_IN_VMARGS(EXACT_MATCH, xxJITServerUseAOTCacheOption, 0);
    int32_t xxDisableJITServerUseAOTCacheArgIndex = FIND_ARG_IN_VMARGS(EXACT_MATCH, xxDisableJITServerUseAOTCacheOption, 0);
+   int32_t xxJITServerAOTCacheNameArgIndex = FIND_ARG_IN_VMARGS(STARTSWITH_MATCH, xxJITServerAOTCacheNameOption, 0);
 
    if (xxJITServerPortArgIndex >= 0)
       {
@@ -1173,6 +1219,13 @@ static bool JITServerParseCommonOptions(J9JavaVM *vm, TR::CompilationInfo *compI
    if (xxJITServerUseAOTCacheArgIndex > xxDisableJITServerUseAOTCacheArgIndex)
       compInfo->getPersistentInfo()->setJITServerUseAOTCache(true);
 
+   if (xxJITServerAOTCacheNameArgIndex >= 0)
+      {
+      char *name = NULL;
+      GET_OPTION_VALUE(xxJITServerAOTCacheNameArgIndex, '=', &name);
+      compInfo->getPersistentInfo()->setJITServerAOTCacheName(name);
+      }
+
    return true;
    }
 #endif /* defined(J9VM_OPT_JITSERVER) */
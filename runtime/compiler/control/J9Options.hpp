@@ -138,6 +138,10 @@ class OMR_EXTENSIBLE Options : public OMR::OptionsConnector
    static int32_t _countForMethodsCompiledDuringStartup;
    static int32_t getCountForMethodsCompiledDuringStartup() { return _countForMethodsCompiledDuringStartup; }
 
+   static bool _useWarmRestartPlan; // record/replay the startup compilations through the SCC
+   static int32_t _warmRestartPlanMaxEntries;
+   static int32_t _countForMethodsInWarmRestartPlan;
+
    static int32_t _countForLoopyBootstrapMethods;
    static int32_t _countForLooplessBootstrapMethods;
    static int32_t getCountForLoopyBootstrapMethods() { return _countForLoopyBootstrapMethods; }
@@ -181,6 +185,7 @@ class OMR_EXTENSIBLE Options : public OMR::OptionsConnector
    static int32_t _iprofilerBufferMaxPercentageToDiscard;
    static int32_t _iProfilerBufferInterarrivalTimeToExitDeepIdle; // ms
    static int32_t _iprofilerBufferSize; //iprofilerbuffer size in kb
+   static int32_t _iprofilerPersistenceRefreshInterval; // ms; 0 means profiles in the SCC are never refreshed
 
    static int32_t _maxIprofilingCount; // when invocation count is larger than
                                        // this value Iprofiler will not collect data
@@ -225,6 +230,10 @@ class OMR_EXTENSIBLE Options : public OMR::OptionsConnector
    inline static int32_t getSafeReservePhysicalMemoryValue() { return _safeReservePhysicalMemoryValue; }
    inline static void setSafeReservePhysicalMemoryValue(int32_t size) { _safeReservePhysicalMemoryValue = size; }
 
+   static bool _scratchMemoryAdmissionControl;
+
+   static bool _collectCompilationPhaseStatistics; // per-phase compilation time histograms
+
    static int32_t _updateFreeMemoryMinPeriod;
    inline static int32_t getUpdateFreeMemoryMinPeriod() { return _updateFreeMemoryMinPeriod; }
    inline static void setUpdateFreeMemoryMinPeriod(int32_t value) { _updateFreeMemoryMinPeriod = value; }
@@ -243,6 +252,7 @@ class OMR_EXTENSIBLE Options : public OMR::OptionsConnector
    static int32_t _numberOfUserClassesLoaded;
    static int32_t _numQueuedInvReqToDowngradeOptLevel;
    static int32_t _qszThresholdToDowngradeOptLevel;
+   static int32_t _codeCacheUsagePercentToShrinkInlining; // inlining budget shrinks once the code cache is this full
    static int32_t _qsziThresholdToDowngradeDuringCLP;
    static int32_t _qszThresholdToDowngradeOptLevelDuringStartup;
    static int32_t _cpuUtilThresholdForStarvation;
@@ -263,6 +273,11 @@ class OMR_EXTENSIBLE Options : public OMR::OptionsConnector
    static int64_t _timeBetweenPurges;
    static bool _shareROMClasses;
    static int32_t _sharedROMClassCacheNumPartitions;
+   static bool _compressJITServerMessages;
+   static int32_t _jitserverAOTCacheMaxSizeKB;
+   static int32_t _jitserverMessageCompressionThreshold;
+   static int32_t _jitserverMaxConcurrentCompilationsPerClient;
+   static int32_t _jitserverSchedulingWeight;
 #endif /* defined(J9VM_OPT_JITSERVER) */
 
    static int32_t _waitTimeToEnterIdleMode;
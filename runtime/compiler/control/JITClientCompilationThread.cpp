@@ -158,8 +158,13 @@ handler_IProfiler_profilingSample(JITServer::ClientStream *client, TR_J9VM *fe,
       }
    }
 
+/**
+ * @brief Answer one query from the server that has already been read into the client stream
+ *
+ * The caller must hold VM access. Returns true if the message ends the remote compilation.
+ */
 static bool
-handleServerMessage(JITServer::ClientStream *client, TR_J9VM *fe, JITServer::MessageType &response)
+dispatchServerMessage(JITServer::ClientStream *client, TR_J9VM *fe, JITServer::MessageType response)
    {
    using JITServer::MessageType;
    TR::CompilationInfoPerThread *compInfoPT = fe->_compInfoPT;
@@ -168,35 +173,6 @@ handleServerMessage(JITServer::ClientStream *client, TR_J9VM *fe, JITServer::Mes
    TR::Compilation *comp = compInfoPT->getCompilation();
    TR::CompilationInfo *compInfo = compInfoPT->getCompilationInfo();
 
-   TR_ASSERT(TR::MonitorTable::get()->getClassUnloadMonitorHoldCount(compInfoPT->getCompThreadId()) == 0, "Must not hold classUnloadMonitor");
-   TR::MonitorTable *table = TR::MonitorTable::get();
-   TR_ASSERT(table && table->isThreadInSafeMonitorState(vmThread), "Must not hold any monitors when waiting for server");
-
-   response = client->read();
-
-   // Acquire VM access and check for possible class unloading
-   acquireVMAccessNoSuspend(vmThread);
-
-   // Update statistics for server message type
-   JITServerHelpers::serverMsgTypeCount[response] += 1;
-
-   // If JVM has unloaded classes inform the server to abort this compilation
-   uint8_t interruptReason = compInfoPT->compilationShouldBeInterrupted();
-   if (interruptReason)
-      {
-      // Inform the server if compilation is not yet complete
-      if ((response != MessageType::compilationCode) &&
-          (response != MessageType::compilationFailure))
-         client->writeError(JITServer::MessageType::compilationInterrupted, 0 /* placeholder */);
-
-      if (TR::Options::isAnyVerboseOptionSet(TR_VerboseJITServer, TR_VerboseCompilationDispatch))
-         TR_VerboseLog::writeLineLocked(TR_Vlog_FAILURE, "Interrupting remote compilation (interruptReason %u) in handleServerMessage(%s) for %s @ %s",
-                                                          interruptReason, JITServer::messageNames[response], comp->signature(), comp->getHotnessName());
-
-      Trc_JITServerInterruptRemoteCompile(vmThread, interruptReason, JITServer::messageNames[response], comp->signature(), comp->getHotnessName());
-      comp->failCompilation<TR::CompilationInterrupted>("Compilation interrupted in handleServerMessage");
-      }
-
    TR::KnownObjectTable *knot = comp->getOrCreateKnownObjectTable();
 
    bool done = false;
@@ -228,6 +204,14 @@ handleServerMessage(JITServer::ClientStream *client, TR_J9VM *fe, JITServer::Mes
          break;
          }
 
+      case MessageType::getMissingCriticalUpdates:
+         {
+         auto recv = client->getRecvData<uint32_t, uint32_t>();
+         std::vector<JITServerHelpers::CriticalUpdate> updates;
+         bool complete = compInfo->getCriticalUpdates(std::get<0>(recv), std::get<1>(recv), updates);
+         client->write(response, complete, updates);
+         }
+         break;
       case MessageType::VM_isClassLibraryClass:
          {
          bool rv = fe->isClassLibraryClass(std::get<0>(client->getRecvData<TR_OpaqueClassBlock*>()));
@@ -2778,6 +2762,73 @@ handleServerMessage(JITServer::ClientStream *client, TR_J9VM *fe, JITServer::Mes
          TR_ASSERT(false, "JITServer: handleServerMessage received an unknown message type: %d\n", response);
       }
 
+   return done;
+   }
+
+static bool
+handleServerMessage(JITServer::ClientStream *client, TR_J9VM *fe, JITServer::MessageType &response)
+   {
+   using JITServer::MessageType;
+   TR::CompilationInfoPerThread *compInfoPT = fe->_compInfoPT;
+   J9VMThread *vmThread = compInfoPT->getCompilationThread();
+   TR::Compilation *comp = compInfoPT->getCompilation();
+
+   TR_ASSERT(TR::MonitorTable::get()->getClassUnloadMonitorHoldCount(compInfoPT->getCompThreadId()) == 0, "Must not hold classUnloadMonitor");
+   TR::MonitorTable *table = TR::MonitorTable::get();
+   TR_ASSERT(table && table->isThreadInSafeMonitorState(vmThread), "Must not hold any monitors when waiting for server");
+
+   response = client->read();
+
+   // Acquire VM access and check for possible class unloading
+   acquireVMAccessNoSuspend(vmThread);
+
+   // Update statistics for server message type
+   JITServerHelpers::serverMsgTypeCount[response] += 1;
+
+   // If JVM has unloaded classes inform the server to abort this compilation
+   uint8_t interruptReason = compInfoPT->compilationShouldBeInterrupted();
+   if (interruptReason)
+      {
+      // Inform the server if compilation is not yet complete
+      if ((response != MessageType::compilationCode) &&
+          (response != MessageType::compilationFailure))
+         client->writeError(JITServer::MessageType::compilationInterrupted, 0 /* placeholder */);
+
+      if (TR::Options::isAnyVerboseOptionSet(TR_VerboseJITServer, TR_VerboseCompilationDispatch))
+         TR_VerboseLog::writeLineLocked(TR_Vlog_FAILURE, "Interrupting remote compilation (interruptReason %u) in handleServerMessage(%s) for %s @ %s",
+                                                          interruptReason, JITServer::messageNames[response], comp->signature(), comp->getHotnessName());
+
+      Trc_JITServerInterruptRemoteCompile(vmThread, interruptReason, JITServer::messageNames[response], comp->signature(), comp->getHotnessName());
+      comp->failCompilation<TR::CompilationInterrupted>("Compilation interrupted in handleServerMessage");
+      }
+
+   bool done = false;
+   if (response == MessageType::batchedRequests)
+      {
+      // The server sent several independent queries at once. Answer each of them
+      // with the regular handler and send all of the answers back in one reply.
+      auto serialRequests = std::get<0>(client->getRecvData<std::vector<std::string>>());
+      client->startBatch(serialRequests.size());
+      for (auto &serialRequest : serialRequests)
+         {
+         MessageType requestType = client->readBatchedRequest(serialRequest);
+         JITServerHelpers::serverMsgTypeCount[requestType] += 1;
+         TR_ASSERT_FATAL((requestType != MessageType::compilationCode) &&
+                         (requestType != MessageType::compilationFailure) &&
+                         (requestType != MessageType::batchedRequests),
+                         "JITServer: message type %s cannot be batched", JITServer::messageNames[requestType]);
+         dispatchServerMessage(client, fe, requestType);
+         // A handler that reported an error with writeError() has aborted the batch
+         if (!client->isBatchingReplies())
+            break;
+         }
+      client->finishBatch();
+      }
+   else
+      {
+      done = dispatchServerMessage(client, fe, response);
+      }
+
    releaseVMAccess(vmThread);
    return done;
    }
@@ -2790,7 +2841,8 @@ remoteCompilationEnd(
    J9Method * method,
    TR::CompilationInfoPerThreadBase *compInfoPT,
    const std::string& codeCacheStr,
-   const std::string& dataCacheStr)
+   const std::string& dataCacheStr,
+   bool isCachedAOTMethod)
    {
    TR_MethodMetaData *relocatedMetaData = NULL;
    TR_J9VM *fe = comp->fej9vm();
@@ -2851,7 +2903,10 @@ remoteCompilationEnd(
 #if defined(J9VM_INTERP_AOT_RUNTIME_SUPPORT)
 
       TR_Debug *debug = TR::Options::getDebug();
-      bool canRelocateMethod = TR::CompilationInfo::canRelocateMethod(comp);
+      // A method served from the JITServer AOT cache was compiled for a different client, so the
+      // client state recorded in this compilation does not match it. Such a method is only stored
+      // in the SCC here, and later loaded from there with the regular AOT load validation.
+      bool canRelocateMethod = !isCachedAOTMethod && TR::CompilationInfo::canRelocateMethod(comp);
 
       if (canRelocateMethod)
          {
@@ -3113,7 +3168,10 @@ remoteCompile(
    uint32_t lastCriticalSeqNo = compInfo->getLastCriticalSeqNo();
    // If needed, update the seqNo of the last request that carried information that needed to be processed in order
    if (!chtableUpdates.first.empty() || !chtableUpdates.second.empty() || !illegalModificationList.empty() || !unloadedClasses.empty())
+      {
       compInfo->setLastCriticalSeqNo(seqNo);
+      compInfo->logCriticalUpdate(seqNo, unloadedClasses, illegalModificationList, chtableUpdates);
+      }
    
    compInfo->getSequencingMonitor()->exit();
 
@@ -3128,6 +3186,13 @@ remoteCompile(
    TR_OptimizationPlan modifiedOptPlan;
    std::vector<SerializedRuntimeAssumption> serializedRuntimeAssumptions;
    std::vector<TR_OpaqueMethodBlock *> methodsRequiringTrampolines;
+   bool isCachedAOTMethod = false;
+   // Only AOT compilations can be shared with other clients through the JITServer AOT cache
+   // The identity lets the server check that all the clients using a cache name have compatible SCCs
+   std::string aotCacheName;
+   const std::string &aotCacheIdentity = compiler->getPersistentInfo()->getJITServerAOTCacheIdentity();
+   if (useAotCompilation && compiler->getPersistentInfo()->getJITServerUseAOTCache() && !aotCacheIdentity.empty())
+      aotCacheName = compiler->getPersistentInfo()->getJITServerAOTCacheName();
    try
       {
       // Release VM access just before sending the compilation request
@@ -3146,7 +3211,8 @@ remoteCompile(
       client->buildCompileRequest(compiler->getPersistentInfo()->getClientUID(), seqNo, lastCriticalSeqNo, romMethodOffset, method,
                                   clazz, *compInfoPT->getMethodBeingCompiled()->_optimizationPlan, detailsStr,
                                   details.getType(), unloadedClasses, illegalModificationList, classInfoTuple, optionsStr, recompMethodInfoStr,
-                                  chtableUpdates.first, chtableUpdates.second, useAotCompilation, TR::Compiler->vm.isVMInStartupPhase(compInfoPT->getJitConfig()));
+                                  chtableUpdates.first, chtableUpdates.second, useAotCompilation, TR::Compiler->vm.isVMInStartupPhase(compInfoPT->getJitConfig()),
+                                  aotCacheName, aotCacheIdentity, TR::Options::_jitserverSchedulingWeight);
       JITServer::MessageType response;
       while(!handleServerMessage(client, compiler->fej9vm(), response));
 
@@ -3160,7 +3226,7 @@ remoteCompile(
          auto recv = client->getRecvData<std::string, std::string, CHTableCommitData, std::vector<TR_OpaqueClassBlock*>,
                                          std::string, std::string, std::vector<TR_ResolvedJ9Method*>,
                                          TR_OptimizationPlan, std::vector<SerializedRuntimeAssumption>, JITServer::ServerMemoryState,
-                                         std::vector<TR_OpaqueMethodBlock *>>();
+                                         std::vector<TR_OpaqueMethodBlock *>, bool>();
          statusCode = compilationOK;
          codeCacheStr = std::get<0>(recv);
          dataCacheStr = std::get<1>(recv);
@@ -3172,6 +3238,7 @@ remoteCompile(
          modifiedOptPlan = std::get<7>(recv);
          serializedRuntimeAssumptions = std::get<8>(recv);
          methodsRequiringTrampolines = std::get<10>(recv);
+         isCachedAOTMethod = std::get<11>(recv);
 
          JITServer::ServerMemoryState nextMemoryState = std::get<9>(recv);
          updateCompThreadActivationPolicy(compInfoPT, nextMemoryState);
@@ -3271,8 +3338,9 @@ remoteCompile(
             // Compilation is done, now we need client to validate all of the records accumulated by the server,
             // so need to exit heuristic region.
             compiler->exitHeuristicRegion();
-            // Populate symbol to id map
-            compiler->getSymbolValidationManager()->deserializeSymbolToIDMap(svmSymbolToIdStr);
+            // Populate symbol to id map; a method served from the AOT cache does not have one
+            if (!isCachedAOTMethod)
+               compiler->getSymbolValidationManager()->deserializeSymbolToIDMap(svmSymbolToIdStr);
             }
 
          TR_ASSERT(codeCacheStr.size(), "must have code cache");
@@ -3281,7 +3349,7 @@ remoteCompile(
          compInfoPT->getMethodBeingCompiled()->_optimizationPlan->clone(&modifiedOptPlan);
 
          // Relocate the received compiled code
-         metaData = remoteCompilationEnd(vmThread, compiler, compilee, method, compInfoPT, codeCacheStr, dataCacheStr);
+         metaData = remoteCompilationEnd(vmThread, compiler, compilee, method, compInfoPT, codeCacheStr, dataCacheStr, isCachedAOTMethod);
          if (metaData)
             {
             // Must add the runtime assumptions received from the server to the RAT and
@@ -167,8 +167,17 @@ outOfProcessCompilationEnd(
                                                          std::vector<TR_ResolvedJ9Method*>(resolvedMirrorMethodsPersistIPInfo->begin(), resolvedMirrorMethodsPersistIPInfo->end()) :
                                                          std::vector<TR_ResolvedJ9Method*>(),
                                      *entry->_optimizationPlan, serializedRuntimeAssumptions, memoryState,
-                                     methodsRequiringTrampolines
+                                     methodsRequiringTrampolines, false
                                      );
+
+   // A method can be shared with other clients only if it does not depend on the state of this client
+   // beyond what is validated at AOT load time
+   const JITServerAOTCacheKey *aotCacheKey = compInfoPT->getAOTCacheKey();
+   if (aotCacheKey && classesThatShouldNotBeNewlyExtended->empty() &&
+       serializedRuntimeAssumptions.empty() && methodsRequiringTrampolines.empty())
+      {
+      compInfoPT->getCompilationInfo()->getJITServerAOTCache()->store(*aotCacheKey, codeCacheStr, dataCacheStr);
+      }
    compInfoPT->clearPerCompilationCaches();
 
    if (TR::Options::getVerboseOption(TR_VerboseJITServer))
@@ -194,9 +203,51 @@ TR::CompilationInfoPerThreadRemote::CompilationInfoPerThreadRemote(TR::Compilati
    _classOfStaticMap(NULL),
    _fieldAttributesCache(NULL),
    _staticAttributesCache(NULL),
-   _isUnresolvedStrCache(NULL)
+   _isUnresolvedStrCache(NULL),
+   _aotCacheKeyIsValid(false),
+   _scheduledClientSession(NULL),
+   _scheduledCompilationStartTime(0)
    {}
 
+/**
+ * @brief Method executed by JITServer when this thread dequeues a request of a known client.
+ *        The session has already been pinned (inUse incremented) by the caller.
+ *        Needs to be executed with compilation monitor in hand.
+ */
+void
+TR::CompilationInfoPerThreadRemote::setScheduledClientSession(ClientSessionData *clientSession)
+   {
+   TR_ASSERT(!_scheduledClientSession, "Previous scheduled compilation was not finished");
+   _scheduledClientSession = clientSession;
+   PORT_ACCESS_FROM_JITCONFIG(_jitConfig);
+   _scheduledCompilationStartTime = j9time_usec_clock();
+   }
+
+/**
+ * @brief Method executed by JITServer at the end of processing a request to charge
+ *        the time spent on it to the client that the request was scheduled for, and
+ *        to release the session pinned when the request was dequeued.
+ *        Needs to be executed with compilation monitor in hand.
+ */
+void
+TR::CompilationInfoPerThreadRemote::finishScheduledCompilation(TR::CompilationInfo *compInfo)
+   {
+   ClientSessionData *clientSession = _scheduledClientSession;
+   if (!clientSession)
+      return;
+   _scheduledClientSession = NULL;
+
+   PORT_ACCESS_FROM_JITCONFIG(_jitConfig);
+   clientSession->recordCompletedScheduledCompilation(j9time_usec_clock() - _scheduledCompilationStartTime);
+   clientSession->decInUse();
+   if (clientSession->getInUse() == 0)
+      compInfo->getClientSessionHT()->deleteClientSession(clientSession->getClientUID(), false);
+
+   // Requests of this client that were skipped because of the limit on concurrent compilations can now be processed
+   if (TR::Options::_jitserverMaxConcurrentCompilationsPerClient > 0 && compInfo->getMethodQueueSize() > 0)
+      compInfo->getCompilationMonitor()->notifyAll();
+   }
+
 /**
  * @brief Method executed by JITServer to dequeue and notify all waiting threads 
  *        that the condition they were waiting for has been fulfilled. 
@@ -310,17 +361,45 @@ TR::CompilationInfoPerThreadRemote::waitForMyTurn(ClientSessionData *clientSessi
             &entry == clientSession->getOOSequenceEntryList() && // Allow only the smallest seqNo which is the head
             !getWaitToBeNotified()) // Avoid a cohort of threads clearing the caches
             {
-            clientSession->clearCaches();
+            // Try to apply only the updates carried by the missing requests; the
+            // caches need to be cleared only if the client cannot provide them
+            bool recovered = false;
+            try
+               {
+               recovered = recoverMissingCriticalUpdates(clientSession, criticalSeqNo);
+               }
+            catch (...)
+               {
+               // The stream can no longer be used for this request. Clear the caches so that
+               // the other waiting requests can go through, then let processEntry handle the error.
+               clientSession->clearCaches();
+               clientSession->setLastProcessedCriticalSeqNo(criticalSeqNo);
+               notifyAndDetachWaitingRequests(clientSession);
+               clientSession->getSequencingMonitor()->exit();
+               throw;
+               }
 
-            if (TR::Options::getVerboseOption(TR_VerboseJITServer))
-               TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer,
-                  "compThreadID=%d has cleared the session caches for clientUID=%llu criticalSeqNo=%u seqNo=%u firstEntry=%p",
-                  getCompThreadId(), clientSession->getClientUID(), criticalSeqNo, seqNo, &entry);
+            if (recovered)
+               {
+               if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+                  TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer,
+                     "compThreadID=%d has recovered the missing critical updates for clientUID=%llu lastProcessedCriticalSeqNo=%u criticalSeqNo=%u seqNo=%u",
+                     getCompThreadId(), clientSession->getClientUID(), clientSession->getLastProcessedCriticalSeqNo(), criticalSeqNo, seqNo);
+               }
+            else
+               {
+               clientSession->clearCaches();
 
-            Trc_JITServerClearedSessionCaches(getCompilationThread(), getCompThreadId(), clientSession,
-                  (unsigned long long)clientSession->getClientUID(),
-                  seqNo, criticalSeqNo, clientSession->getNumActiveThreads(), &entry,
-                  clientSession->getLastProcessedCriticalSeqNo(), seqNo);
+               if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+                  TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer,
+                     "compThreadID=%d has cleared the session caches for clientUID=%llu criticalSeqNo=%u seqNo=%u firstEntry=%p",
+                     getCompThreadId(), clientSession->getClientUID(), criticalSeqNo, seqNo, &entry);
+
+               Trc_JITServerClearedSessionCaches(getCompilationThread(), getCompThreadId(), clientSession,
+                     (unsigned long long)clientSession->getClientUID(),
+                     seqNo, criticalSeqNo, clientSession->getNumActiveThreads(), &entry,
+                     clientSession->getLastProcessedCriticalSeqNo(), seqNo);
+               }
 
             clientSession->setLastProcessedCriticalSeqNo(criticalSeqNo);// Allow myself to go through
             notifyAndDetachWaitingRequests(clientSession);
@@ -352,6 +431,48 @@ TR::CompilationInfoPerThreadRemote::waitForMyTurn(ClientSessionData *clientSessi
    }
 
 
+/**
+ * @brief Method executed by a compilation thread at JITServer that timed out waiting for
+ *        the critical requests in (lastProcessedCriticalSeqNo, criticalSeqNo] to arrive.
+ *        Asks the client for the updates carried by those requests and applies them, so that
+ *        only the cached data of the affected classes is evicted.
+ *        Needs to be executed with sequencingMonitor in hand and no active threads for the client.
+ *
+ * @return true if all missing updates have been applied; false if the caches must be cleared
+ */
+bool
+TR::CompilationInfoPerThreadRemote::recoverMissingCriticalUpdates(ClientSessionData *clientSession, uint32_t criticalSeqNo)
+   {
+   // If the caches are already cleared they will be fetched again in their entirety
+   if (clientSession->cachesAreCleared())
+      return false;
+
+   JITServer::ServerStream *stream = getMethodBeingCompiled()->_stream;
+   stream->write(JITServer::MessageType::getMissingCriticalUpdates, clientSession->getLastProcessedCriticalSeqNo(), criticalSeqNo);
+   auto recv = stream->read<bool, std::vector<JITServerHelpers::CriticalUpdate>>();
+   if (!std::get<0>(recv))
+      return false; // The client no longer has all the updates
+
+   auto chTable = (JITServerPersistentCHTable*)clientSession->getCHTable();
+   for (const auto &update : std::get<1>(recv))
+      {
+      auto &unloadedClasses = std::get<1>(update);
+      auto &illegalModificationList = std::get<2>(update);
+      auto &chtableUnloads = std::get<3>(update);
+      auto &chtableMods = std::get<4>(update);
+
+      if (!unloadedClasses.empty())
+         clientSession->processUnloadedClasses(unloadedClasses, true); // this locks getROMMapMonitor()
+      if (!illegalModificationList.empty())
+         clientSession->processIllegalFinalFieldModificationList(illegalModificationList); // this locks getROMMapMonitor()
+      // An uninitialized CHTable will be fetched in its entirety by the next request that needs it
+      if ((!chtableUnloads.empty() || !chtableMods.empty()) && chTable->isInitialized())
+         chTable->doUpdate(_vm, chtableUnloads, chtableMods);
+      }
+   return true;
+   }
+
+
 /**
  * @brief Method executed by JITServer to process the compilation request.
  */
@@ -391,12 +512,13 @@ TR::CompilationInfoPerThreadRemote::processEntry(TR_MethodToBeCompiled &entry, J
    // hasIncNumActiveThreads is used to determine if decNumActiveThreads() should be
    // called when an exception is thrown.
    bool hasIncNumActiveThreads = false;
+   bool sentCachedAOTMethod = false;
    try
       {
       auto req = stream->readCompileRequest<uint64_t, uint32_t, uint32_t, uint32_t, J9Method *, J9Class*,
          TR_OptimizationPlan, std::string, J9::IlGeneratorMethodDetailsType,
          std::vector<TR_OpaqueClassBlock*>, std::vector<TR_OpaqueClassBlock*>, 
-         JITServerHelpers::ClassInfoTuple, std::string, std::string, std::string, std::string, bool, bool>();
+         JITServerHelpers::ClassInfoTuple, std::string, std::string, std::string, std::string, bool, bool, std::string, std::string, int32_t>();
 
       clientId                           = std::get<0>(req);
       seqNo                              = std::get<1>(req); // Sequence number at the client
@@ -415,6 +537,8 @@ TR::CompilationInfoPerThreadRemote::processEntry(TR_MethodToBeCompiled &entry, J
       const std::string &chtableUnloads  = std::get<14>(req);
       const std::string &chtableMods     = std::get<15>(req);
       useAotCompilation                  = std::get<16>(req);
+      const std::string &aotCacheName    = std::get<18>(req);
+      const std::string &aotCacheIdentity = std::get<19>(req);
 
       TR_ASSERT_FATAL(TR::Compiler->persistentMemory() == compInfo->persistentMemory(), "per-client persistent memory must not be set at this point");
       isCriticalRequest = !chtableMods.empty() || !chtableUnloads.empty() || !illegalModificationList.empty() || !unloadedClasses.empty();
@@ -458,6 +582,7 @@ TR::CompilationInfoPerThreadRemote::processEntry(TR_MethodToBeCompiled &entry, J
       TR_ASSERT(!clientSession->usesPerClientMemory() || TR::Compiler->persistentMemory() != compInfo->persistentMemory(), "per-client persistent memory must be set at this point");
 
       clientSession->setIsInStartupPhase(std::get<17>(req));
+      clientSession->setSchedulingWeight(std::get<20>(req));
       } // End critical section
 
      if (TR::Options::getVerboseOption(TR_VerboseJITServer))
@@ -671,6 +796,38 @@ TR::CompilationInfoPerThreadRemote::processEntry(TR_MethodToBeCompiled &entry, J
       // If we want something then we need to increaseQueueWeightBy(weight) while holding compilation monitor
       entry._weight = 0;
       entry._useAotCompilation = useAotCompilation;
+
+      // Clients that use the same AOT cache name share the AOT compiled methods stored by the server
+      _aotCacheKeyIsValid = false;
+      JITServerAOTCache *aotCache = compInfo->getJITServerAOTCache();
+      if (aotCache && useAotCompilation && !aotCacheName.empty() &&
+          !aotCache->isCompatibleClient(aotCacheName, aotCacheIdentity))
+         {
+         // Code that was compiled for a different SCC or JVM configuration must
+         // neither be sent to this client nor be polluted by its compilations
+         if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+            TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer,
+               "compThreadID=%d clientUID=%llu does not match the SCC of AOT cache %s; not using the AOT cache",
+               getCompThreadId(), (unsigned long long)clientId, aotCacheName.c_str());
+         }
+      else if (aotCache && useAotCompilation && !aotCacheName.empty())
+         {
+         _aotCacheKey = JITServerAOTCacheKey(aotCacheName, romClass, romMethod, optPlan->getOptLevel());
+         _aotCacheKeyIsValid = true;
+
+         std::string codeCacheStr, dataCacheStr;
+         if (aotCache->find(_aotCacheKey, codeCacheStr, dataCacheStr))
+            {
+            // The cached method was compiled for another client and does not depend on any
+            // state specific to this client, so it is sent without the per-compilation data
+            stream->finishCompilation(codeCacheStr, dataCacheStr, CHTableCommitData(), std::vector<TR_OpaqueClassBlock*>(),
+                                      std::string(), std::string(), std::vector<TR_ResolvedJ9Method*>(),
+                                      *optPlan, std::vector<SerializedRuntimeAssumption>(),
+                                      computeServerMemoryState(compInfo), std::vector<TR_OpaqueMethodBlock *>(), true);
+            sentCachedAOTMethod = true;
+            abortCompilation = true;
+            }
+         }
       }
    catch (const JITServer::StreamFailure &e)
       {
@@ -815,7 +972,12 @@ TR::CompilationInfoPerThreadRemote::processEntry(TR_MethodToBeCompiled &entry, J
 
       if (TR::Options::getVerboseOption(TR_VerboseJITServer))
          {
-         if (getClientData())
+         if (sentCachedAOTMethod)
+            {
+            TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "compThreadID=%d sent a method from the AOT cache to clientUID=%llu seqNo=%u",
+               getCompThreadId(), getClientData()->getClientUID(), getSeqNo());
+            }
+         else if (getClientData())
             {
             TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "compThreadID=%d did an early abort for clientUID=%llu seqNo=%u",
                getCompThreadId(), getClientData()->getClientUID(), getSeqNo());
@@ -843,6 +1005,7 @@ TR::CompilationInfoPerThreadRemote::processEntry(TR_MethodToBeCompiled &entry, J
          TR_OptimizationPlan::freeOptimizationPlan(optPlan);
          }
 
+      finishScheduledCompilation(compInfo);
       compInfo->requeueOutOfProcessEntry(&entry);
 
       // Reset the pointer to the cached client session data
@@ -932,6 +1095,7 @@ TR::CompilationInfoPerThreadRemote::processEntry(TR_MethodToBeCompiled &entry, J
 
    // Put the request back into the pool
    setMethodBeingCompiled(NULL);
+   finishScheduledCompilation(compInfo);
    compInfo->requeueOutOfProcessEntry(&entry);
    compInfo->printQueue();
 
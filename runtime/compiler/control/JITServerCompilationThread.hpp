@@ -26,6 +26,7 @@
 #include "control/CompilationThread.hpp"
 #include "env/j9methodServer.hpp"
 #include "runtime/JITClientSession.hpp"
+#include "runtime/JITServerAOTCache.hpp"
 
 class TR_IPBytecodeHashTableEntry;
 
@@ -56,6 +57,7 @@ class CompilationInfoPerThreadRemote : public TR::CompilationInfoPerThread
 
    void notifyAndDetachWaitingRequests(ClientSessionData *clientSession);
    void waitForMyTurn(ClientSessionData *clientSession, TR_MethodToBeCompiled &entry); // Return false if timeout
+   bool recoverMissingCriticalUpdates(ClientSessionData *clientSession, uint32_t criticalSeqNo);
    bool getWaitToBeNotified() const { return _waitToBeNotified; }
    void setWaitToBeNotified(bool b) { _waitToBeNotified = b; }
 
@@ -103,6 +105,13 @@ class CompilationInfoPerThreadRemote : public TR::CompilationInfoPerThread
    void deleteClientSessionData(uint64_t clientId, TR::CompilationInfo* compInfo, J9VMThread* compThread);
    virtual void freeAllResources() override;
 
+   // Returns NULL if the method being compiled cannot be stored in the JITServer AOT cache
+   const JITServerAOTCacheKey *getAOTCacheKey() const { return _aotCacheKeyIsValid ? &_aotCacheKey : NULL; }
+
+   // Fair-share scheduling of compilations among clients; must be called with compilation monitor in hand
+   void setScheduledClientSession(ClientSessionData *clientSession);
+   void finishScheduledCompilation(TR::CompilationInfo *compInfo);
+
    private:
    /* Template method for allocating a cache of type T on the heap.
     * Cache pointer must be NULL.
@@ -172,6 +181,10 @@ class CompilationInfoPerThreadRemote : public TR::CompilationInfoPerThread
    FieldOrStaticAttrTable_t *_fieldAttributesCache;
    FieldOrStaticAttrTable_t *_staticAttributesCache;
    UnorderedMap<std::pair<TR_OpaqueClassBlock *, int32_t>, TR_IsUnresolvedString> *_isUnresolvedStrCache;
+   JITServerAOTCacheKey _aotCacheKey;
+   bool _aotCacheKeyIsValid;
+   ClientSessionData *_scheduledClientSession; // session pinned when the current request was dequeued; NULL if unknown client
+   uint64_t _scheduledCompilationStartTime; // usec
    }; // class CompilationInfoPerThreadRemote
 } // namespace TR
 
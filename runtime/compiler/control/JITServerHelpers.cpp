@@ -22,6 +22,8 @@
 
 #include "control/JITServerHelpers.hpp"
 
+#include <algorithm>
+
 #include "control/CompilationRuntime.hpp"
 #include "control/JITServerCompilationThread.hpp"
 #include "control/MethodToBeCompiled.hpp"
@@ -711,6 +713,53 @@ JITServerHelpers::getAndCacheRAMClassInfo(J9Class *clazz, ClientSessionData *cli
    return false;
    }
 
+// Make sure that the ROMClass info of all the given classes is cached. The classes
+// that are not cached yet are requested from the client in a single batch, which
+// costs one round trip instead of one per class.
+void
+JITServerHelpers::cacheRemoteROMClassBatch(ClientSessionData *clientSessionData, JITServer::ServerStream *stream, const std::vector<J9Class *> &classes)
+   {
+   std::vector<std::tuple<J9Class *>> requests;
+      {
+      OMR::CriticalSection getRemoteROMClass(clientSessionData->getROMMapMonitor());
+      auto &romClassMap = clientSessionData->getROMClassMap();
+      for (J9Class *clazz : classes)
+         {
+         if (clazz && (romClassMap.find(clazz) == romClassMap.end()) &&
+             (std::find(requests.begin(), requests.end(), std::make_tuple(clazz)) == requests.end()))
+            requests.push_back(std::make_tuple(clazz));
+         }
+      }
+   if (requests.empty())
+      return;
+
+   std::vector<std::tuple<ClassInfoTuple>> replies;
+   if (requests.size() == 1)
+      {
+      stream->write(JITServer::MessageType::ResolvedMethod_getRemoteROMClassAndMethods, std::get<0>(requests[0]));
+      replies.push_back(stream->read<ClassInfoTuple>());
+      }
+   else
+      {
+      stream->writeBatch(JITServer::MessageType::ResolvedMethod_getRemoteROMClassAndMethods, requests);
+      replies = stream->readBatch<ClassInfoTuple>(requests.size());
+      }
+
+   OMR::CriticalSection cacheRemoteROMClass(clientSessionData->getROMMapMonitor());
+   for (size_t i = 0; i < requests.size(); i++)
+      {
+      J9Class *clazz = std::get<0>(requests[i]);
+      // Another thread may have cached the class while the monitor was released
+      if (clientSessionData->getROMClassMap().find(clazz) == clientSessionData->getROMClassMap().end())
+         {
+         ClientSessionData::ClassInfo classInfo;
+         auto &classInfoTuple = std::get<0>(replies[i]);
+         auto romClass = romClassFromString(std::get<0>(classInfoTuple), TR::comp()->trMemory()->trPersistentMemory());
+         JITServerHelpers::cacheRemoteROMClass(clientSessionData, clazz, romClass, &classInfoTuple, classInfo);
+         }
+      }
+   }
+
 void
 JITServerHelpers::getROMClassData(const ClientSessionData::ClassInfo &classInfo, ClassInfoDataType dataType, void *data)
    {
@@ -71,6 +71,14 @@ class JITServerHelpers
       uintptr_t, std::vector<J9ROMMethod *>                          // 20: _classChainOffsetOfIdentifyingLoaderForClazz 21. _origROMMethods
       >;
 
+   // Information carried by a critical compilation request that must be processed by the server in order:
+   // 0: seqNo of the request  1: unloaded classes  2: classes with illegal final field modifications
+   // 3: CHTable removes  4: CHTable modifications
+   using CriticalUpdate = std::tuple
+      <
+      uint32_t, std::vector<TR_OpaqueClassBlock *>, std::vector<TR_OpaqueClassBlock *>, std::string, std::string
+      >;
+
    static ClassInfoTuple packRemoteROMClassInfo(J9Class *clazz, J9VMThread *vmThread, TR_Memory *trMemory, bool serializeClass);
    static void cacheRemoteROMClass(ClientSessionData *clientSessionData, J9Class *clazz, J9ROMClass *romClass, ClassInfoTuple *classInfoTuple);
    static void cacheRemoteROMClass(ClientSessionData *clientSessionData, J9Class *clazz, J9ROMClass *romClass, ClassInfoTuple *classInfoTuple, ClientSessionData::ClassInfo &classInfo);
@@ -81,6 +89,7 @@ class JITServerHelpers
    static bool getAndCacheRAMClassInfo(J9Class *clazz, ClientSessionData *clientSessionData, JITServer::ServerStream *stream, ClassInfoDataType dataType, void *data);
    static bool getAndCacheRAMClassInfo(J9Class *clazz, ClientSessionData *clientSessionData, JITServer::ServerStream *stream, ClassInfoDataType dataType1, void *data1,
                                        ClassInfoDataType dataType2, void *data2);
+   static void cacheRemoteROMClassBatch(ClientSessionData *clientSessionData, JITServer::ServerStream *stream, const std::vector<J9Class *> &classes);
    static J9ROMMethod *romMethodOfRamMethod(J9Method* method);
 
    static void insertIntoOOSequenceEntryList(ClientSessionData *clientData, TR_MethodToBeCompiled *entry);
@@ -27,6 +27,7 @@
 #include "control/MethodToBeCompiled.hpp"
 #include "control/CompilationRuntime.hpp"
 #include "control/CompilationThread.hpp"
+#include "control/CompilationPhaseStatistics.hpp"
 #include "env/ut_j9jit.h"
 #include "env/VMAccessCriticalSection.hpp"
 #include "ilgen/J9ByteCodeIlGenerator.hpp"
@@ -249,6 +250,16 @@ runJitdump(char *label, J9RASdumpContext *context, J9RASdumpAgent *agent)
       }
 #endif
 
+   // Compilation phase statistics are printed for requested dumps (e.g. user signal) only;
+   // on a crash the statistics monitor could be held by the crashed thread
+   if (context && context->javaVM && context->javaVM->jitConfig &&
+       J9_ARE_NO_BITS_SET(context->eventFlags, J9RAS_DUMP_ON_GP_FAULT | J9RAS_DUMP_ON_ABORT_SIGNAL | J9RAS_DUMP_ON_TRACE_ASSERT))
+      {
+      TR::CompilationInfo *compInfo = TR::CompilationInfo::get(context->javaVM->jitConfig);
+      if (compInfo && compInfo->getCompilationPhaseStatistics())
+         compInfo->getCompilationPhaseStatistics()->print(stderr);
+      }
+
    char *crashedThreadName = getOMRVMThreadName(crashedThread->omrVMThread);
    j9nls_printf(PORTLIB, J9NLS_INFO | J9NLS_STDERR, J9NLS_DMP_OCCURRED_THREAD_NAME_ID, "JIT", crashedThreadName, crashedThread);
 
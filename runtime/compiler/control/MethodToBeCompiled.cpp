@@ -57,6 +57,8 @@ void TR_MethodToBeCompiled::initialize(TR::IlGeneratorMethodDetails & details, v
    _methodDetails = TR::IlGeneratorMethodDetails::clone(_methodDetailsStorage, details);
    _optimizationPlan = optimizationPlan;
    _next = NULL;
+   _prev = NULL;
+   _nextInQueueIndex = NULL;
    _oldStartPC = oldStartPC;
    _newStartPC = NULL;
    _priority = p;
@@ -70,6 +72,7 @@ void TR_MethodToBeCompiled::initialize(TR::IlGeneratorMethodDetails & details, v
    _tryCompilingAgain = false;
    _compInfoPT = NULL;
    _aotCodeToBeRelocated = NULL;
+   _scratchMemoryReservation = 0;
    if (_optimizationPlan)
       _optimizationPlan->setIsAotLoad(false);
    _async = false;
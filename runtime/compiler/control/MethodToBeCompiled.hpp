@@ -80,6 +80,8 @@ struct TR_MethodToBeCompiled
 #endif /* defined(J9VM_OPT_JITSERVER) */
 
    TR_MethodToBeCompiled *_next;
+   TR_MethodToBeCompiled *_prev;            // previous entry in the compilation queue; only valid while queued
+   TR_MethodToBeCompiled *_nextInQueueIndex; // next queued entry in the same slot of the compilation queue index
    TR::IlGeneratorMethodDetails _methodDetailsStorage;
    TR::IlGeneratorMethodDetails *_methodDetails;
    void                  *_oldStartPC;
@@ -88,6 +90,7 @@ struct TR_MethodToBeCompiled
    char                   _monitorName[30]; // to be able to deallocate the string
    TR_OptimizationPlan   *_optimizationPlan;
    uint64_t              _entryTime; // time it was added to the queue (ms)
+   uint64_t              _scratchMemoryReservation; // expected scratch memory footprint (bytes) accounted for in CompilationInfo
    TR::CompilationInfoPerThreadBase *_compInfoPT; // pointer to the thread that is handling this request
    const void *           _aotCodeToBeRelocated;
 
@@ -0,0 +1,226 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "control/WarmRestartPlan.hpp"
+
+#include <stdlib.h>
+#include <string.h>
+#include "j9.h"
+#include "j9nonbuilder.h"
+#include "shcflags.h"
+#include "control/Options.hpp"
+#include "env/J9SharedCache.hpp"
+#include "env/VerboseLog.hpp"
+#include "env/VMJ9.h"
+#include "infra/CriticalSection.hpp"
+#include "infra/Monitor.hpp"
+
+const char * const TR_WarmRestartPlan::PLAN_KEY = "J9JIT_WarmRestartPlan";
+
+TR_WarmRestartPlan::TR_WarmRestartPlan(TR_J9SharedCache *sc, int32_t maxEntries) :
+   _sharedCache(sc),
+   _monitor(NULL),
+   _state(DONE),
+   _maxEntries(maxEntries),
+   _numEntries(0),
+   _recordedEntries(NULL),
+   _replayEntries(NULL)
+   {
+   }
+
+TR_WarmRestartPlan *
+TR_WarmRestartPlan::create(TR_J9SharedCache *sc, J9VMThread *vmThread, int32_t maxEntries)
+   {
+   if (!sc || maxEntries <= 0)
+      return NULL;
+
+   TR_WarmRestartPlan *plan = new (PERSISTENT_NEW) TR_WarmRestartPlan(sc, maxEntries);
+   if (!plan)
+      return NULL;
+
+   if (plan->load(vmThread))
+      {
+      plan->_state = REPLAYING;
+      }
+   else
+      {
+      // No plan in the SCC yet; this run will record one
+      plan->_monitor = TR::Monitor::create("JIT-WarmRestartPlanMonitor");
+      plan->_recordedEntries = (Entry *)jitPersistentAlloc(maxEntries * sizeof(Entry));
+      if (plan->_monitor && plan->_recordedEntries)
+         plan->_state = RECORDING;
+      }
+
+   if (TR::Options::getCmdLineOptions()->getVerboseOption(TR_VerbosePerformance))
+      {
+      TR_VerboseLog::writeLineLocked(TR_Vlog_PERF, "Warm restart plan: %s (%d entries)",
+         plan->isReplaying() ? "replaying" : (plan->isRecording() ? "recording" : "disabled"), plan->_numEntries);
+      }
+   return plan;
+   }
+
+bool
+TR_WarmRestartPlan::load(J9VMThread *vmThread)
+   {
+   J9SharedClassConfig *scConfig = vmThread->javaVM->sharedClassConfig;
+   J9SharedDataDescriptor descriptor;
+   descriptor.address = NULL;
+   scConfig->findSharedData(vmThread, PLAN_KEY, strlen(PLAN_KEY), J9SHR_DATA_TYPE_JITHINT, FALSE, &descriptor, NULL);
+   if (!descriptor.address || descriptor.length < sizeof(Header))
+      return false;
+
+   const Header *header = (const Header *)descriptor.address;
+   if (header->_version != PLAN_VERSION ||
+       descriptor.length < sizeof(Header) + header->_numEntries * sizeof(Entry))
+      return false;
+
+   const Entry *entries = (const Entry *)(header + 1);
+   _replayEntries = (ReplayEntry *)jitPersistentAlloc(header->_numEntries * sizeof(ReplayEntry));
+   if (!_replayEntries)
+      return false;
+
+   // Keep only the first time compilations whose ROMMethod is still in the SCC
+   int32_t numReplayEntries = 0;
+   for (uint32_t i = 0; i < header->_numEntries; i++)
+      {
+      J9ROMMethod *romMethod = NULL;
+      if (!(entries[i]._flags & IS_UPGRADE) &&
+          _sharedCache->isROMMethodOffsetInSharedCache(entries[i]._romMethodOffset, &romMethod))
+         {
+         _replayEntries[numReplayEntries]._romMethod = romMethod;
+         _replayEntries[numReplayEntries]._entry = entries + i;
+         numReplayEntries++;
+         }
+      }
+   // qsort is not stable; compareReplayEntries uses the entry address as a
+   // tie breaker so that the earliest compilation of a method is found first
+   qsort(_replayEntries, numReplayEntries, sizeof(ReplayEntry), compareReplayEntries);
+   _numEntries = numReplayEntries;
+   return true;
+   }
+
+int
+TR_WarmRestartPlan::compareReplayEntries(const void *a, const void *b)
+   {
+   const ReplayEntry *e1 = (const ReplayEntry *)a;
+   const ReplayEntry *e2 = (const ReplayEntry *)b;
+   if (e1->_romMethod != e2->_romMethod)
+      return (uintptr_t)e1->_romMethod < (uintptr_t)e2->_romMethod ? -1 : 1;
+   if (e1->_entry != e2->_entry)
+      return (uintptr_t)e1->_entry < (uintptr_t)e2->_entry ? -1 : 1;
+   return 0;
+   }
+
+void
+TR_WarmRestartPlan::recordCompilation(J9VMThread *vmThread, J9Method *method, TR_Hotness optLevel, bool isUpgrade)
+   {
+   if (!isRecording())
+      return;
+
+   uintptr_t romMethodOffset = 0;
+   if (!_sharedCache->isROMMethodInSharedCache(J9_ROM_METHOD_FROM_RAM_METHOD(method), &romMethodOffset))
+      return;
+
+   bool planIsFull = false;
+      {
+      OMR::CriticalSection recording(_monitor);
+      // The plan stays RECORDING until persist() runs outside of the monitor,
+      // so other compilation threads can still get here once it is full
+      if (!isRecording() || _numEntries >= _maxEntries)
+         return;
+      Entry &entry = _recordedEntries[_numEntries++];
+      entry._romMethodOffset = romMethodOffset;
+      entry._optLevel = (uint8_t)optLevel;
+      entry._flags = isUpgrade ? IS_UPGRADE : 0;
+      entry._reserved = 0;
+      planIsFull = (_numEntries >= _maxEntries);
+      }
+
+   if (planIsFull)
+      persist(vmThread);
+   }
+
+void
+TR_WarmRestartPlan::persist(J9VMThread *vmThread)
+   {
+   if (!_monitor)
+      return;
+
+   // The SCC copies the data, so a temporary buffer is enough. Take a snapshot
+   // of the entries under the monitor and store it after releasing the monitor
+   // so that compilation threads do not block on the SCC write.
+   PORT_ACCESS_FROM_JAVAVM(vmThread->javaVM);
+   Header *header = NULL;
+   UDATA length = 0;
+      {
+      OMR::CriticalSection persisting(_monitor);
+      if (!isRecording())
+         return;
+      _state = DONE;
+      if (_numEntries == 0)
+         return;
+
+      length = sizeof(Header) + _numEntries * sizeof(Entry);
+      header = (Header *)j9mem_allocate_memory(length, J9MEM_CATEGORY_JIT);
+      if (!header)
+         return;
+      header->_version = PLAN_VERSION;
+      header->_numEntries = _numEntries;
+      memcpy(header + 1, _recordedEntries, _numEntries * sizeof(Entry));
+      }
+
+   J9SharedDataDescriptor descriptor;
+   descriptor.address = (U_8 *)header;
+   descriptor.length = length;
+   descriptor.type = J9SHR_DATA_TYPE_JITHINT;
+   descriptor.flags = J9SHRDATA_SINGLE_STORE_FOR_KEY_TYPE;
+   const U_8 *stored = vmThread->javaVM->sharedClassConfig->storeSharedData(vmThread, PLAN_KEY, strlen(PLAN_KEY), &descriptor);
+   j9mem_free_memory(header);
+
+   if (TR::Options::getCmdLineOptions()->getVerboseOption(TR_VerbosePerformance))
+      {
+      TR_VerboseLog::writeLineLocked(TR_Vlog_PERF, "Warm restart plan: %s %d entries in the SCC",
+         stored ? "stored" : "failed to store", _numEntries);
+      }
+   }
+
+const TR_WarmRestartPlan::Entry *
+TR_WarmRestartPlan::findFirstCompilation(J9ROMMethod *romMethod) const
+   {
+   if (!isReplaying())
+      return NULL;
+
+   // Binary search for the first entry of romMethod
+   int32_t low = 0;
+   int32_t high = _numEntries;
+   while (low < high)
+      {
+      int32_t mid = low + (high - low) / 2;
+      if ((uintptr_t)_replayEntries[mid]._romMethod < (uintptr_t)romMethod)
+         low = mid + 1;
+      else
+         high = mid;
+      }
+   if (low < _numEntries && _replayEntries[low]._romMethod == romMethod)
+      return _replayEntries[low]._entry;
+   return NULL;
+   }
@@ -0,0 +1,137 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef WARMRESTARTPLAN_HPP
+#define WARMRESTARTPLAN_HPP
+
+#pragma once
+
+#include <stdint.h>
+#include "compile/CompilationTypes.hpp"
+#include "env/TRMemory.hpp"
+
+namespace TR { class Monitor; }
+class TR_J9SharedCache;
+struct J9Method;
+struct J9ROMMethod;
+struct J9VMThread;
+
+/**
+ * @class TR_WarmRestartPlan
+ * @brief Ordered list of the compilations performed during the startup of a cold run,
+ *        persisted in the shared classes cache and replayed by subsequent runs.
+ *
+ * The first run that uses a given SCC records, in the order in which the compilation
+ * threads finish them, the methods compiled during startup together with their
+ * optimization level and whether the compilation was an upgrade. The list is stored
+ * under a single key in the SCC (either when it reaches the maximum number of entries
+ * or at JIT shutdown). Subsequent runs find the list in the SCC and replay it: methods
+ * of the plan get a very small initial invocation count when their class is loaded,
+ * and their first compilation uses the optimization level recorded in the plan.
+ * Upgrades are still triggered by sampling.
+ */
+class TR_WarmRestartPlan
+   {
+public:
+   TR_PERSISTENT_ALLOC(TR_Memory::PersistentInfo);
+
+   enum EntryFlags
+      {
+      IS_UPGRADE = 0x1,
+      };
+
+   struct Entry
+      {
+      uintptr_t _romMethodOffset; // offset of the J9ROMMethod in the SCC
+      uint8_t   _optLevel;        // TR_Hotness
+      uint8_t   _flags;           // EntryFlags
+      uint16_t  _reserved;
+      };
+
+   /**
+    * @brief Creates the plan and determines whether this run records or replays it
+    * @param sc The shared cache of the AOT frontend
+    * @param vmThread The current thread
+    * @param maxEntries Maximum number of compilations recorded in the plan
+    * @return The new plan or NULL if it could not be allocated
+    */
+   static TR_WarmRestartPlan *create(TR_J9SharedCache *sc, J9VMThread *vmThread, int32_t maxEntries);
+
+   bool isRecording() const { return _state == RECORDING; }
+   bool isReplaying() const { return _state == REPLAYING; }
+
+   /**
+    * @brief Appends a successful compilation to the plan. Must be called by compilation threads.
+    */
+   void recordCompilation(J9VMThread *vmThread, J9Method *method, TR_Hotness optLevel, bool isUpgrade);
+
+   /**
+    * @brief Stores the recorded plan into the SCC. Subsequent calls have no effect.
+    */
+   void persist(J9VMThread *vmThread);
+
+   /**
+    * @brief Searches the replayed plan for the first time compilation of the given method
+    * @return The entry describing the first compilation of the method or NULL if not found
+    */
+   const Entry *findFirstCompilation(J9ROMMethod *romMethod) const;
+
+   int32_t getNumEntries() const { return _numEntries; }
+
+private:
+   enum State
+      {
+      RECORDING,
+      REPLAYING,
+      DONE,
+      };
+
+   struct ReplayEntry
+      {
+      J9ROMMethod *_romMethod;
+      const Entry *_entry;
+      };
+
+   struct Header
+      {
+      uint32_t _version;
+      uint32_t _numEntries;
+      // followed by _numEntries Entry structures
+      };
+
+   static const uint32_t PLAN_VERSION = 1;
+   static const char * const PLAN_KEY;
+
+   TR_WarmRestartPlan(TR_J9SharedCache *sc, int32_t maxEntries);
+   bool load(J9VMThread *vmThread);
+   static int compareReplayEntries(const void *a, const void *b);
+
+   TR_J9SharedCache *_sharedCache;
+   TR::Monitor      *_monitor;
+   State             _state;
+   int32_t           _maxEntries;
+   int32_t           _numEntries;
+   Entry            *_recordedEntries; // used when recording
+   ReplayEntry      *_replayEntries;   // sorted by J9ROMMethod address; used when replaying
+   };
+
+#endif // WARMRESTARTPLAN_HPP
@@ -51,6 +51,7 @@
 #include "codegen/PrivateLinkage.hpp"
 #include "control/CompilationRuntime.hpp"
 #include "control/CompilationThread.hpp"
+#include "control/CompilationPhaseStatistics.hpp"
 #include "control/JitDump.hpp"
 #include "control/Recompilation.hpp"
 #include "control/RecompilationInfo.hpp"
@@ -83,6 +84,7 @@
 #include "control/rossa.h"
 #include "control/OptimizationPlan.hpp"
 #include "control/CompilationController.hpp"
+#include "control/WarmRestartPlan.hpp"
 #include "runtime/IProfiler.hpp"
 
 #define _UTE_STATIC_
@@ -104,6 +106,7 @@
 #include "j9cfg.h"
 #include "vmaccess.h"
 #include "jvminit.h"
+#include "shchelp.h"
 #include "j9port.h"
 #include "ras/DebugExt.hpp"
 #include "env/exports.h"
@@ -114,6 +117,7 @@
 #include "net/LoadSSLLibs.hpp"
 #include "runtime/JITClientSession.hpp"
 #include "runtime/Listener.hpp"
+#include "runtime/JITServerAOTCache.hpp"
 #include "runtime/JITServerSharedROMClassCache.hpp"
 #include "runtime/JITServerStatisticsThread.hpp"
 #include "runtime/JITServerIProfiler.hpp"
@@ -672,6 +676,18 @@ getCodeCacheColdAlloc(void *codeCache)
    return cc->getColdCodeAlloc();
    }
 
+// Used by the CompilationMXBean to retrieve the compilation phase statistics.
+// Returns the length of the complete report (0 if statistics are not collected),
+// which may exceed the size of the buffer.
+extern "C" UDATA
+printCompilationPhaseStatistics(J9JITConfig *jitConfig, char *buffer, UDATA bufferSize)
+   {
+   TR::CompilationInfo *compInfo = getCompilationInfo(jitConfig);
+   if (!compInfo || !compInfo->getCompilationPhaseStatistics())
+      return 0;
+   return compInfo->getCompilationPhaseStatistics()->print(buffer, bufferSize);
+   }
+
 
 // -----------------------------------------------------------------------------
 // JIT control
@@ -1133,6 +1149,7 @@ onLoadInternal(
 #endif
    jitConfig->promoteGPUCompile = promoteGPUCompile;
    jitConfig->command = command;
+   jitConfig->printCompilationPhaseStatistics = printCompilationPhaseStatistics;
    jitConfig->bcSizeLimit = 0xFFFF;
 
 #ifdef J9VM_OPT_JAVA_CRYPTO_ACCELERATION
@@ -1701,6 +1718,19 @@ onLoadInternal(
          }
       }
 
+   if ((compInfo->getPersistentInfo()->getRemoteCompilationMode() == JITServer::SERVER) &&
+       compInfo->getPersistentInfo()->getJITServerUseAOTCache() && !TR::Options::_shareROMClasses)
+      {
+      // The AOT cache identifies methods by ROMClass hashes that are computed using SSL.
+      // The library is already loaded if ROMClass sharing is enabled.
+      if (!JITServer::loadLibsslAndFindSymbols())
+         {
+         if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+            TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "Failed to load SSL library, disabling AOT cache");
+         compInfo->getPersistentInfo()->setJITServerUseAOTCache(false);
+         }
+      }
+
    if (compInfo->getPersistentInfo()->getRemoteCompilationMode() == JITServer::SERVER)
       {
       JITServer::CommunicationStream::initConfigurationFlags();
@@ -1740,6 +1770,16 @@ onLoadInternal(
          compInfo->setJITServerSharedROMClassCache(cache);
          }
 
+      //NOTE: This must be done only after the SSL library has been successfully loaded
+      if (compInfo->getPersistentInfo()->getJITServerUseAOTCache())
+         {
+         size_t maxSize = (size_t)std::max(0, TR::Options::_jitserverAOTCacheMaxSizeKB) * 1024;
+         auto cache = new (PERSISTENT_NEW) JITServerAOTCache(maxSize);
+         if (!cache)
+            return -1;
+         compInfo->setJITServerAOTCache(cache);
+         }
+
       }
    else if (compInfo->getPersistentInfo()->getRemoteCompilationMode() == JITServer::CLIENT)
       {
@@ -1784,6 +1824,14 @@ onLoadInternal(
 
    jitConfig->printAOTHeaderProcessorFeatures = printAOTHeaderProcessorFeatures;
 
+   if (TR::Options::_collectCompilationPhaseStatistics)
+      {
+      TR_CompilationPhaseStatistics *phaseStats = new (PERSISTENT_NEW) TR_CompilationPhaseStatistics();
+      if (!phaseStats)
+         return -1;
+      compInfo->setCompilationPhaseStatistics(phaseStats);
+      }
+
    if (!TR::Compiler->target.cpu.isI386())
       {
       TR_J2IThunkTable *ieThunkTable = new (PERSISTENT_NEW) TR_J2IThunkTable(persistentMemory, "InvokeExactJ2IThunkTable");
@@ -1795,6 +1843,47 @@ onLoadInternal(
    }
 
 
+#if defined(J9VM_OPT_JITSERVER) && defined(J9VM_OPT_SHARED_CLASSES)
+// Describes the SCC of this client to the JITServer AOT cache. AOT code cached by the
+// server refers to client data through SCC offsets, so it can only be shared by clients
+// whose AOT header (VM and JIT build, target CPU, GC and object model settings) and SCC
+// layers match. Returns an empty string if the SCC holds no AOT header.
+static std::string
+computeJITServerAOTCacheIdentity(TR::CompilationInfo *compInfo, J9JavaVM *javaVM, J9VMThread *curThread)
+   {
+   const TR_AOTHeader *hdrInCache = compInfo->reloRuntime()->getStoredAOTHeader(curThread);
+   if (!hdrInCache)
+      return std::string();
+
+   TR_AOTHeader header = *hdrInCache;
+   header.relativeMethodMetaDataTable = NULL; // not part of the configuration
+   std::string identity((const char *)&header, sizeof(header));
+
+   J9SharedClassCacheDescriptor *firstCache = javaVM->sharedClassConfig->cacheDescriptorList;
+   J9SharedClassCacheDescriptor *curCache = firstCache;
+   do
+      {
+      UDATA cacheSize = curCache->cacheSizeBytes;
+      identity.append((const char *)&cacheSize, sizeof(cacheSize));
+      curCache = curCache->next;
+      }
+   while (curCache != firstCache);
+
+   // The configuration and sizes above can be the same for two different caches. Add the creation
+   // time of each layer so that the identity can only match a client attached to the very same SCC,
+   // whose offsets the AOT code in the server cache refers to
+   if (javaVM->sharedClassConfig->getCacheCreateTimes)
+      {
+      U_64 createTimes[J9SH_LAYER_NUM_MAX_VALUE + 1];
+      UDATA numLayers = javaVM->sharedClassConfig->getCacheCreateTimes(javaVM, createTimes, J9SH_LAYER_NUM_MAX_VALUE + 1);
+      identity.append((const char *)createTimes, numLayers * sizeof(createTimes[0]));
+      }
+
+   return identity;
+   }
+#endif /* defined(J9VM_OPT_JITSERVER) && defined(J9VM_OPT_SHARED_CLASSES) */
+
+
 extern "C" int32_t
 aboutToBootstrap(J9JavaVM * javaVM, J9JITConfig * jitConfig)
    {
@@ -1965,6 +2054,15 @@ aboutToBootstrap(J9JavaVM * javaVM, J9JITConfig * jitConfig)
             TR::Compiler->relocatableTarget.cpu = TR::CPU::customize(compInfo->reloRuntime()->getProcessorDescriptionFromSCC(fe, curThread));
             jitConfig->relocatableTargetProcessor = TR::Compiler->relocatableTarget.cpu.getProcessorDescription();
             }
+
+#if defined(J9VM_OPT_JITSERVER)
+         if ((compInfo->getPersistentInfo()->getRemoteCompilationMode() == JITServer::CLIENT) &&
+             compInfo->getPersistentInfo()->getJITServerUseAOTCache() &&
+             (static_cast<TR_JitPrivateConfig *>(jitConfig->privateConfig)->aotValidHeader != TR_no))
+            {
+            compInfo->getPersistentInfo()->setJITServerAOTCacheIdentity(computeJITServerAOTCacheIdentity(compInfo, javaVM, curThread));
+            }
+#endif /* defined(J9VM_OPT_JITSERVER) */
          }
 
       if (TR::Options::getAOTCmdLineOptions()->getOption(TR_NoStoreAOT))
@@ -1991,6 +2089,16 @@ aboutToBootstrap(J9JavaVM * javaVM, J9JITConfig * jitConfig)
             }
 #endif
          }
+
+      if (TR::Options::_useWarmRestartPlan && TR::Options::sharedClassCache()
+#if defined(J9VM_OPT_JITSERVER)
+          && compInfo->getPersistentInfo()->getRemoteCompilationMode() != JITServer::SERVER
+#endif
+         )
+         {
+         TR_J9SharedCache *sc = TR_J9VMBase::get(jitConfig, curThread, TR_J9VMBase::AOT_VM)->sharedCache();
+         compInfo->setWarmRestartPlan(TR_WarmRestartPlan::create(sc, curThread, TR::Options::_warmRestartPlanMaxEntries));
+         }
       }
 #endif
 
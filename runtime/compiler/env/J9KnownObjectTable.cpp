@@ -36,9 +36,12 @@
 
 J9::KnownObjectTable::KnownObjectTable(TR::Compilation *comp) :
       OMR::KnownObjectTableConnector(comp),
-   _references(comp->trMemory())
+   _references(comp->trMemory()),
+   _firstIndexOfClass(decltype(_firstIndexOfClass)::allocator_type(comp->trMemory()->heapMemoryRegion())),
+   _nextIndexOfSameClass(comp->trMemory())
    {
    _references.add(NULL); // Reserve index zero for NULL
+   _nextIndexOfSameClass.add(0);
    }
 
 
@@ -98,9 +101,10 @@ J9::KnownObjectTable::getOrCreateIndex(uintptr_t objectPointer)
 
       // Search for existing matching entry
       //
-      for (uint32_t i = 1; i < nextIndex; i++)
-         if (*_references.element(i) == objectPointer)
-            return i;
+      TR_OpaqueClassBlock *clazz = fej9->getObjectClass(objectPointer);
+      Index existingIndex = lookupExistingIndex(objectPointer, clazz);
+      if (existingIndex != UNKNOWN)
+         return existingIndex;
 
       // No luck -- allocate a new one
       //
@@ -108,6 +112,11 @@ J9::KnownObjectTable::getOrCreateIndex(uintptr_t objectPointer)
       TR_ASSERT(thread, "assertion failure");
       _references.setSize(nextIndex+1);
       _references[nextIndex] = (uintptr_t*)thread->javaVM->internalVMFunctions->j9jni_createLocalRef((JNIEnv*)thread, (j9object_t)objectPointer);
+
+      Index &firstIndex = _firstIndexOfClass[clazz]; // 0 if this is the first object of its class
+      _nextIndexOfSameClass.setSize(nextIndex+1);
+      _nextIndexOfSameClass[nextIndex] = firstIndex;
+      firstIndex = nextIndex;
       }
 
    return nextIndex;
@@ -179,19 +188,32 @@ J9::KnownObjectTable::getExistingIndexAt(uintptr_t *objectReferenceLocation)
       TR::VMAccessCriticalSection getExistingIndexAtCriticalSection(self()->comp());
 
       uintptr_t objectPointer = *objectReferenceLocation;
-      for (Index i = 0; i < self()->getEndIndex() && (result == UNKNOWN); i++)
-         {
-         if (self()->getPointer(i) == objectPointer)
-            {
-            result = i;
-            break;
-            }
-         }
+      if (objectPointer == 0)
+         result = 0;
+      else
+         result = lookupExistingIndex(objectPointer, ((TR_J9VMBase *)(self()->fe()))->getObjectClass(objectPointer));
       }
    return result;
    }
 
 
+TR::KnownObjectTable::Index
+J9::KnownObjectTable::lookupExistingIndex(uintptr_t objectPointer, TR_OpaqueClassBlock *clazz)
+   {
+   // Must be called with VM access, so that the object cannot move during the search
+   auto it = _firstIndexOfClass.find(clazz);
+   if (it == _firstIndexOfClass.end())
+      return UNKNOWN;
+
+   for (Index i = it->second; i != 0; i = _nextIndexOfSameClass[i])
+      {
+      if (*_references.element(i) == objectPointer)
+         return i;
+      }
+   return UNKNOWN;
+   }
+
+
 uintptr_t
 J9::KnownObjectTable::getPointer(Index index)
    {
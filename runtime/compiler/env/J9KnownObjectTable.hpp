@@ -35,6 +35,7 @@ namespace J9 { typedef J9::KnownObjectTable KnownObjectTableConnector; }
 #include "env/OMRKnownObjectTable.hpp"
 #include "infra/Annotations.hpp"
 #include "infra/Array.hpp"
+#include "env/PersistentCollections.hpp"
 #include "infra/BitVector.hpp"
 #if defined(J9VM_OPT_JITSERVER)
 #include <tuple>
@@ -78,6 +79,13 @@ class OMR_EXTENSIBLE KnownObjectTable : public OMR::KnownObjectTableConnector
    friend class ::TR_DebugExt;
    TR_Array<uintptr_t*> _references;
 
+   // Objects can move whenever VM access is released, so entries are indexed by
+   // the class of the object rather than by its address. _firstIndexOfClass maps
+   // a class to its most recently added entry, and _nextIndexOfSameClass links each
+   // entry to the previous one of the same class (0 ends the chain).
+   UnorderedMap<TR_OpaqueClassBlock *, Index> _firstIndexOfClass;
+   TR_Array<Index> _nextIndexOfSameClass;
+
 public:
    TR_ALLOC(TR_Memory::FrontEnd);
 
@@ -106,6 +114,8 @@ public:
 
 private:
 
+   Index lookupExistingIndex(uintptr_t objectPointer, TR_OpaqueClassBlock *clazz);
+
    void dumpObjectTo(TR::FILE *file, Index i, const char *fieldName, const char *sep,  TR::Compilation *comp, TR_BitVector &visited, TR_VMFieldsInfo **fieldsInfoByIndex, int32_t depth);
    };
 
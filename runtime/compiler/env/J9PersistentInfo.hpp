@@ -334,6 +334,10 @@ class PersistentInfo : public OMR::PersistentInfoConnector
    void setClientUID(uint64_t val) { _clientUID = val; }
    bool getJITServerUseAOTCache() const { return _JITServerUseAOTCache; }
    void setJITServerUseAOTCache(bool use) { _JITServerUseAOTCache = use; }
+   const std::string &getJITServerAOTCacheName() const { return _JITServerAOTCacheName; }
+   void setJITServerAOTCacheName(const char *name) { _JITServerAOTCacheName = name; }
+   const std::string &getJITServerAOTCacheIdentity() const { return _JITServerAOTCacheIdentity; }
+   void setJITServerAOTCacheIdentity(const std::string &identity) { _JITServerAOTCacheIdentity = identity; }
 #endif /* defined(J9VM_OPT_JITSERVER) */
 
    private:
@@ -424,6 +428,8 @@ class PersistentInfo : public OMR::PersistentInfoConnector
    uint32_t    _socketTimeoutMs; // timeout for communication sockets used in out-of-process JIT compilation
    uint64_t    _clientUID;
    bool        _JITServerUseAOTCache;
+   std::string _JITServerAOTCacheName; // clients that use the same name must use the same shared class cache
+   std::string _JITServerAOTCacheIdentity; // describes the SCC of the client; the server rejects clients of a cache name whose identity differs
 #endif /* defined(J9VM_OPT_JITSERVER) */
    };
 
@@ -146,6 +146,7 @@ TR_J9SharedCache::TR_J9SharedCache(TR_J9VMBase *fe)
    _aotStats = fe->getPrivateConfig()->aotStats;
    _sharedCacheConfig = _javaVM->sharedClassConfig;
    _numDigitsForCacheOffsets = 8;
+   memset(_classChainCache, 0, sizeof(_classChainCache));
 
 #if defined(J9VM_OPT_JITSERVER)
    TR_ASSERT_FATAL(_sharedCacheConfig || _compInfo->getPersistentInfo()->getRemoteCompilationMode() == JITServer::SERVER, "Must have _sharedCacheConfig");
@@ -888,10 +889,18 @@ TR_J9SharedCache::rememberClass(J9Class *clazz, bool create)
 
    LOG(3, "\tkey created: %.*s\n", keyLength, key);
 
+   chainData = getCachedClassChain(classOffsetInCache);
+   if (chainData != NULL)
+      {
+      LOG(1, "\tchain found in JIT class chain cache (%p) so nothing to store\n", chainData);
+      return chainData;
+      }
+
    chainData = findChainForClass(clazz, key, keyLength);
    if (chainData != NULL)
       {
       LOG(1, "\tchain exists (%p) so nothing to store\n", chainData);
+      cacheClassChain(classOffsetInCache, chainData);
       return chainData;
       }
 
@@ -940,6 +949,7 @@ TR_J9SharedCache::rememberClass(J9Class *clazz, bool create)
    if (chainData)
       {
       LOG(1, "\tstored data, chain at %p\n", chainData);
+      cacheClassChain(classOffsetInCache, chainData);
       }
    else
       {
@@ -1088,6 +1098,22 @@ TR_J9SharedCache::romclassMatchesCachedVersion(J9ROMClass *romClass, UDATA * & c
    return true;
    }
 
+UDATA *
+TR_J9SharedCache::getCachedClassChain(uintptr_t classOffsetInCache)
+   {
+   UDATA *chainData = _classChainCache[(classOffsetInCache >> 4) & (CLASS_CHAIN_CACHE_SIZE - 1)];
+   // The first ROMClass in a chain is the one the chain was built for
+   if ((NULL != chainData) && (chainData[1] == classOffsetInCache))
+      return chainData;
+   return NULL;
+   }
+
+void
+TR_J9SharedCache::cacheClassChain(uintptr_t classOffsetInCache, UDATA *chainData)
+   {
+   _classChainCache[(classOffsetInCache >> 4) & (CLASS_CHAIN_CACHE_SIZE - 1)] = chainData;
+   }
+
 UDATA *
 TR_J9SharedCache::findChainForClass(J9Class *clazz, const char *key, uint32_t keyLength)
    {
@@ -519,6 +519,27 @@ private:
     */
    bool cacheCCVResult(TR_OpaqueClassBlock *clazz, CCVResult result);
 
+   /**
+    * \brief Looks up the class chain stored in the SCC for a ROMClass in the
+    *        JIT-local class chain cache, without calling into the SCC.
+    *
+    * \param[in] classOffsetInCache The offset of the ROMClass in the SCC
+    *
+    * \return The class chain if it has been cached; NULL otherwise.
+    */
+   UDATA *getCachedClassChain(uintptr_t classOffsetInCache);
+
+   /**
+    * \brief Records the class chain stored in the SCC for a ROMClass in the
+    *        JIT-local class chain cache.
+    *
+    * \param[in] classOffsetInCache The offset of the ROMClass in the SCC
+    * \param[in] chainData The class chain found in or stored into the SCC
+    */
+   void cacheClassChain(uintptr_t classOffsetInCache, UDATA *chainData);
+
+   static const uint32_t CLASS_CHAIN_CACHE_SIZE = 256; // must be a power of 2
+
    uint16_t _initialHintSCount;
    uint16_t _hintsEnabledMask;
 
@@ -534,6 +555,10 @@ private:
    uint32_t _logLevel;
    bool _verboseHints;
 
+   // Direct-mapped cache of class chains, indexed by ROMClass offset. Entries are only ever
+   // replaced by whole pointers, and chains stored in the SCC are never freed, so no locking is needed.
+   UDATA *_classChainCache[CLASS_CHAIN_CACHE_SIZE];
+
    static TR_J9SharedCacheDisabledReason _sharedCacheState;
    static TR_YesNoMaybe                  _sharedCacheDisabledBecauseFull;
    static UDATA                          _storeSharedDataFailedLength;
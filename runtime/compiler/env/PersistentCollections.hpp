@@ -23,6 +23,7 @@
 #ifndef PERSISTENT_COLLECTIONS_H
 #define PERSISTENT_COLLECTIONS_H
 
+#include <deque>
 #include <vector>
 #include <unordered_map>
 #include <unordered_set>
@@ -32,6 +33,11 @@ using PersistentVectorAllocator = TR::typed_allocator<T, TR::PersistentAllocator
 template<typename T>
 using PersistentVector = std::vector<T, PersistentVectorAllocator<T>>;
 
+template<typename T>
+using PersistentDequeAllocator = TR::typed_allocator<T, TR::PersistentAllocator&>;
+template<typename T>
+using PersistentDeque = std::deque<T, PersistentDequeAllocator<T>>;
+
 template<typename T>
 using PersistentUnorderedSetAllocator = TR::typed_allocator<T, TR::PersistentAllocator&>;
 template<typename T>
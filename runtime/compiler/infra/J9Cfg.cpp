@@ -140,6 +140,8 @@ J9::CFG::setFrequencies()
          _externalProfiler = comp()->fej9()->hasIProfilerBlockFrequencyInfo(*comp());
          TR_BitVector *nodesToBeNormalized = self()->setBlockAndEdgeFrequenciesBasedOnJITProfiler();
          self()->normalizeFrequencies(nodesToBeNormalized);
+         if (hasJPI && this == comp()->getFlowGraph())
+            self()->markBlocksNotExecutedUnderJProfilingCold();
          if (comp()->getOption(TR_TraceBFGeneration))
             {
             traceMsg(comp(), "CFG of %s after setting frequencies using JITProfiling\n", self()->getMethodSymbol()->signature(comp()->trMemory()));
@@ -206,6 +208,55 @@ J9::CFG::setFrequencies()
    }
 
 
+// JProfiling block counts are exact, so a block whose count is still zero after
+// the method body has run many times was never taken while profiling.  Marking
+// such blocks cold lets block ordering move them to the end of the method and
+// keeps them out of the hot instruction stream.
+//
+void
+J9::CFG::markBlocksNotExecutedUnderJProfilingCold()
+   {
+   static char *disableJProfilingColdBlocks = feGetEnv("TR_disableJProfilingColdBlocks");
+   if (disableJProfilingColdBlocks)
+      return;
+
+   static char *minEntryCountStr = feGetEnv("TR_JProfilingColdBlockMinEntryCount");
+   static const int32_t minEntryCount = minEntryCountStr ? atoi(minEntryCountStr) : 1000;
+
+   TR_PersistentProfileInfo *profileInfo = getProfilingInfoForCFG(comp(), self());
+   TR_BlockFrequencyInfo *blockFrequencyInfo = profileInfo ? profileInfo->getBlockFrequencyInfo() : NULL;
+   if (!blockFrequencyInfo || !blockFrequencyInfo->isJProfilingData())
+      return;
+
+   TR_ByteCodeInfo methodEntry;
+   methodEntry.setByteCodeIndex(0);
+   methodEntry.setCallerIndex(comp()->getCurrentInlinedSiteIndex());
+   int32_t entryCount = blockFrequencyInfo->getFrequencyInfo(methodEntry, comp(), false, false);
+   if (entryCount < minEntryCount)
+      return;
+
+   for (TR::CFGNode *node = getFirstNode(); node; node = node->getNext())
+      {
+      TR::Block *block = toBlock(node);
+      if (!block->getEntry()
+          || block->isCold()
+          || block->isCatchBlock()
+          || block->isOSRCodeBlock()
+          || block->isOSRCatchBlock())
+         continue;
+
+      if (blockFrequencyInfo->getFrequencyInfo(block, comp()) != 0)
+         continue;
+
+      if (comp()->getOption(TR_TraceBFGeneration))
+         traceMsg(comp(), "Marking block_%d cold: not executed in %d JProfiling method entries\n", block->getNumber(), entryCount);
+
+      block->setIsCold();
+      block->setFrequency(MAX_COLD_BLOCK_COUNT+1);
+      }
+   }
+
+
 #define GUESS_THRESHOLD 100
 
 static bool isVirtualGuard(TR::Node *ifNode)
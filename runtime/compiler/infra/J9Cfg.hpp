@@ -86,6 +86,7 @@ public:
 
    void setBlockAndEdgeFrequenciesBasedOnStructure();
    TR_BitVector *setBlockAndEdgeFrequenciesBasedOnJITProfiler();
+   void markBlocksNotExecutedUnderJProfilingCold();
    void setBlockFrequenciesBasedOnInterpreterProfiler();
    void computeInitialBlockFrequencyBasedOnExternalProfiler(TR::Compilation *comp);
    void propagateFrequencyInfoFromExternalProfiler(TR_ExternalProfiler *profiler);
@@ -24,6 +24,8 @@
 #include "control/CompilationRuntime.hpp"
 #include "control/Options.hpp"
 #include "env/VerboseLog.hpp"
+#include "infra/CriticalSection.hpp"
+#include "infra/Monitor.hpp"
 #include "net/LoadSSLLibs.hpp"
 #include <sys/types.h>
 #include <sys/socket.h>
@@ -119,6 +121,15 @@ int ClientStream::static_init(TR::PersistentInfo *info)
    // verify server identity using standard method
    (*OSSL_CTX_set_verify)(ctx, SSL_VERIFY_PEER, NULL);
 
+   // Remember the last session handed out by the server so that reconnections
+   // (e.g. after a socket timeout) can resume it instead of doing a full handshake
+   _sslSessionMonitor = TR::Monitor::create("JITServer-SSLSessionMonitor");
+   if (_sslSessionMonitor)
+      {
+      (*OSSL_CTX_ctrl)(ctx, SSL_CTRL_SET_SESS_CACHE_MODE, SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE, NULL);
+      (*OSSL_CTX_sess_set_new_cb)(ctx, ClientStream::cacheSSLSession);
+      }
+
    _sslCtx = ctx;
 
    if (TR::Options::getVerboseOption(TR_VerboseJITServer))
@@ -127,6 +138,36 @@ int ClientStream::static_init(TR::PersistentInfo *info)
    }
 
 SSL_CTX *ClientStream::_sslCtx = NULL;
+SSL_SESSION *ClientStream::_sslSession = NULL;
+TR::Monitor *ClientStream::_sslSessionMonitor = NULL;
+
+// Called by OpenSSL whenever the server issues a new session (or session ticket).
+// Returning 1 tells OpenSSL that we have taken ownership of the session reference.
+int ClientStream::cacheSSLSession(SSL *ssl, SSL_SESSION *session)
+   {
+   SSL_SESSION *oldSession = NULL;
+      {
+      OMR::CriticalSection cacheSession(_sslSessionMonitor);
+      oldSession = _sslSession;
+      _sslSession = session;
+      }
+   if (oldSession)
+      (*OSSL_SESSION_free)(oldSession);
+   return 1;
+   }
+
+void ClientStream::resumeSSLSession(SSL *ssl)
+   {
+   if (!_sslSessionMonitor)
+      return;
+
+   OMR::CriticalSection resumeSession(_sslSessionMonitor);
+   // SSL_set_session takes its own reference, so the cached session
+   // stays valid even if it gets replaced while the handshake is in progress.
+   // If the server no longer accepts it, OpenSSL falls back to a full handshake.
+   if (_sslSession)
+      (*OSSL_set_session)(ssl, _sslSession);
+   }
 
 int openConnection(const std::string &address, uint32_t port, uint32_t timeoutMs)
    {
@@ -225,6 +266,7 @@ BIO *openSSLConnection(SSL_CTX *ctx, int connfd)
       }
 
    (*OSSL_set_connect_state)(ssl);
+   ClientStream::resumeSSLSession(ssl);
 
    if ((*OSSL_set_fd)(ssl, connfd) != 1)
       {
@@ -278,7 +320,7 @@ BIO *openSSLConnection(SSL_CTX *ctx, int connfd)
    }
 
 ClientStream::ClientStream(TR::PersistentInfo *info)
-   : CommunicationStream(), _versionCheckStatus(NOT_DONE)
+   : CommunicationStream(), _versionCheckStatus(NOT_DONE), _isBatchingReplies(false)
    {
    int connfd = openConnection(info->getJITServerAddress(), info->getJITServerPort(), info->getSocketTimeout());
    BIO *ssl = openSSLConnection(_sslCtx, connfd);
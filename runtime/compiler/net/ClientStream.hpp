@@ -31,6 +31,7 @@
 #include <openssl/ssl.h>
 class SSLOutputStream;
 class SSLInputStream;
+namespace TR { class Monitor; }
 
 namespace JITServer
 {
@@ -85,9 +86,11 @@ public:
    template <typename... T>
    void buildCompileRequest(T... args)
       {
+      // A batch left unfinished by a previous compilation must not capture this request
+      abandonBatch();
       if (getVersionCheckStatus() == NOT_DONE)
          {
-         _cMsg.setFullVersion(getJITServerVersion(), CONFIGURATION_FLAGS);
+         _cMsg.setFullVersion(getJITServerVersion(), CONFIGURATION_FLAGS | getCapabilityFlags());
          write(MessageType::compilationRequest, args...);
          _cMsg.clearFullVersion();
          }
@@ -110,7 +113,17 @@ public:
       _cMsg.setType(type);
       setArgsRaw<T...>(_cMsg, args...);
 
-      writeMessage(_cMsg);
+      if (_isBatchingReplies)
+         {
+         // The reply is held back and sent together with the
+         // other replies to the batch by finishBatch()
+         _batchedReplies.push_back(_cMsg.serializeToString());
+         _cMsg.clearForWrite();
+         }
+      else
+         {
+         writeMessage(_cMsg);
+         }
       }
 
    /**
@@ -123,6 +136,8 @@ public:
    MessageType read()
       {
       readMessage(_sMsg);
+      // The server advertises its capabilities once our version check has passed
+      enableCapabilities(_sMsg.capabilityFlags());
       return _sMsg.type();
       }
 
@@ -135,6 +150,66 @@ public:
       return getArgsRaw<T...>(_sMsg);
       }
 
+   /**
+      @brief Start answering a `batchedRequests` message from the server
+
+      Until finishBatch() is called, every reply given with write() is held back
+      by the stream instead of being sent over the network.
+
+      @param [in] numRequests Number of queries in the batch
+   */
+   void startBatch(size_t numRequests)
+      {
+      _batchedReplies.clear();
+      _batchedReplies.reserve(numRequests);
+      _isBatchingReplies = true;
+      }
+
+   /**
+      @brief Make one query of a batch the current message
+
+      After this call, getRecvData() returns the arguments of the query,
+      which can then be answered as if it had been read from the network.
+
+      @param [in] serialRequest The serialized query, as found in the `batchedRequests` message
+      @return Returns the type of the query
+   */
+   MessageType readBatchedRequest(const std::string &serialRequest)
+      {
+      _sMsg.deserializeFromString(serialRequest);
+      return _sMsg.type();
+      }
+
+   /**
+      @brief Send the replies to all of the queries in the current batch in a single message
+
+      Nothing is sent if the batch was aborted by writeError(): the error was the
+      last message of the exchange and the server does not expect anything after it.
+   */
+   void finishBatch()
+      {
+      if (!_isBatchingReplies)
+         return;
+      _isBatchingReplies = false;
+      write(MessageType::batchedRequests, _batchedReplies);
+      _batchedReplies.clear();
+      }
+
+   /**
+      @brief Returns true while the replies to a batch are being held back, i.e. between
+      startBatch() and finishBatch(), unless writeError() has aborted the batch
+   */
+   bool isBatchingReplies() const { return _isBatchingReplies; }
+
+   /**
+      @brief Discard the replies to the current batch, if any, without sending them
+   */
+   void abandonBatch()
+      {
+      _isBatchingReplies = false;
+      _batchedReplies.clear();
+      }
+
    /**
       @brief Send an error message to the JITServer
 
@@ -145,6 +220,8 @@ public:
    template <typename ...T>
    void writeError(MessageType type, T... args)
       {
+      // Errors always go out immediately; any partial batch is obsolete
+      abandonBatch();
       _cMsg.setType(type);
       if (type == MessageType::compilationInterrupted || type == MessageType::connectionTerminate)
          {
@@ -204,16 +281,29 @@ public:
    static int getNumConnectionsOpened() { return _numConnectionsOpened; }
    static int getNumConnectionsClosed() { return _numConnectionsClosed; }
 
+   /**
+      @brief Offer the most recent TLS session received from the server for resumption
+
+      Must be called on a new SSL connection before the handshake is started.
+   */
+   static void resumeSSLSession(SSL *ssl);
+
 private:
    static int _numConnectionsOpened;
    static int _numConnectionsClosed;
    VersionCheckStatus _versionCheckStatus; // indicates whether a version checking has been performed
+   bool _isBatchingReplies; // true while answering the queries of a batchedRequests message
+   std::vector<std::string> _batchedReplies; // serialized replies to the queries of the current batch
    static int _incompatibilityCount;
    static uint64_t _incompatibleStartTime; // Time when version incomptibility has been detected
    static const uint64_t RETRY_COMPATIBILITY_INTERVAL_MS; // (ms) When we should perform again a version compatibilty check
    static const int INCOMPATIBILITY_COUNT_LIMIT;
 
    static SSL_CTX *_sslCtx;
+   static SSL_SESSION *_sslSession; // most recent session issued by the server, used for TLS session resumption
+   static TR::Monitor *_sslSessionMonitor; // protects _sslSession
+
+   static int cacheSSLSession(SSL *ssl, SSL_SESSION *session);
    };
 
 }
@@ -20,15 +20,22 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
  *******************************************************************************/
 
+#include <string.h>
 #include "control/CompilationRuntime.hpp"
 #include "control/Options.hpp" // TR::Options::useCompressedPointers()
 #include "env/CompilerEnv.hpp" // for TR::Compiler->target.is64Bit()
 #include "net/CommunicationStream.hpp"
+#include "zlib.h"
 
 
 namespace JITServer
 {
 uint32_t CommunicationStream::CONFIGURATION_FLAGS = 0;
+uint64_t CommunicationStream::_numMessagesCompressed = 0;
+uint64_t CommunicationStream::_numBytesBeforeCompression = 0;
+uint64_t CommunicationStream::_numBytesAfterCompression = 0;
+uint64_t CommunicationStream::_compressionCPUTime = 0;
+uint64_t CommunicationStream::_decompressionCPUTime = 0;
 #ifdef MESSAGE_SIZE_STATS
 TR_Stats JITServer::CommunicationStream::collectMsgStat[];
 #endif
@@ -60,6 +67,22 @@ void CommunicationStream::initSSL()
    // OpenSSL_add_ssl_algorithms();
    }
 
+uint32_t
+CommunicationStream::getCapabilityFlags()
+   {
+   uint32_t flags = 0;
+   if (TR::Options::_compressJITServerMessages)
+      flags |= JITServerAcceptsCompression;
+   return flags;
+   }
+
+void
+CommunicationStream::enableCapabilities(uint32_t peerCapabilityFlags)
+   {
+   if (peerCapabilityFlags & getCapabilityFlags() & JITServerAcceptsCompression)
+      _peerAcceptsCompression = true;
+   }
+
 void
 CommunicationStream::readMessage2(Message &msg)
    {
@@ -68,6 +91,13 @@ CommunicationStream::readMessage2(Message &msg)
    // read message size
    uint32_t serializedSize;
    readBlocking(serializedSize);
+   if (serializedSize & COMPRESSED_MESSAGE_FLAG)
+      {
+      msg.setSerializedSize(serializedSize);
+      readCompressedMessage(msg, serializedSize & MESSAGE_SIZE_MASK, sizeof(uint32_t));
+      return;
+      }
+   serializedSize &= MESSAGE_SIZE_MASK;
 
    msg.expandBufferIfNeeded(serializedSize);
    msg.setSerializedSize(serializedSize);
@@ -106,6 +136,12 @@ CommunicationStream::readMessage(Message &msg)
 
    // bytesRead >= sizeof(uint32_t)
    uint32_t serializedSize = ((uint32_t *)buffer)[0];
+   if (serializedSize & COMPRESSED_MESSAGE_FLAG)
+      {
+      readCompressedMessage(msg, serializedSize & MESSAGE_SIZE_MASK, bytesRead);
+      return;
+      }
+   serializedSize &= MESSAGE_SIZE_MASK;
    if (bytesRead > serializedSize)
       {
       throw JITServer::StreamFailure("JITServer I/O error: read more than the message size");
@@ -138,12 +174,85 @@ CommunicationStream::readMessage(Message &msg)
 #endif
    }
 
+void
+CommunicationStream::readCompressedMessage(Message &msg, uint32_t frameSize, uint32_t bytesRead)
+   {
+   if ((frameSize < COMPRESSED_HEADER_SIZE) || (bytesRead > frameSize))
+      throw JITServer::StreamFailure("JITServer I/O error: invalid size of compressed message");
+
+   // The beginning of the frame was read into the message buffer; move it to
+   // the scratch buffer and read the rest of the frame there
+   _compressionBuffer.resize(frameSize);
+   memcpy(_compressionBuffer.data(), msg.getBufferStartForRead(), bytesRead);
+   msg.clearForRead();
+   if (bytesRead < frameSize)
+      readBlocking(_compressionBuffer.data() + bytesRead, frameSize - bytesRead);
+
+   uint32_t serializedSize = ((uint32_t *)_compressionBuffer.data())[1];
+   if (serializedSize > msg.getBufferCapacity())
+      msg.expandBuffer(serializedSize, 0);
+
+   uint64_t startTime = j9thread_get_self_cpu_time(j9thread_self());
+   uLongf inflatedSize = serializedSize;
+   int rc = uncompress((Bytef *)msg.getBufferStartForRead(), &inflatedSize,
+                       (const Bytef *)_compressionBuffer.data() + COMPRESSED_HEADER_SIZE, frameSize - COMPRESSED_HEADER_SIZE);
+   _decompressionCPUTime += j9thread_get_self_cpu_time(j9thread_self()) - startTime;
+
+   if ((rc != Z_OK) || (inflatedSize != serializedSize) || (((uint32_t *)msg.getBufferStartForRead())[0] != serializedSize))
+      throw JITServer::StreamFailure("JITServer I/O error: cannot decompress message");
+
+   msg.setSerializedSize(serializedSize);
+
+   // rebuild the message
+   msg.deserialize();
+
+#ifdef MESSAGE_SIZE_STATS
+   collectMsgStat[int(msg.type())].update(serializedSize);
+#endif
+   }
+
+bool
+CommunicationStream::writeCompressedMessage(const char *serialMsg, uint32_t serializedSize)
+   {
+   uLong maxFrameSize = COMPRESSED_HEADER_SIZE + compressBound(serializedSize);
+   if (_compressionBuffer.size() < maxFrameSize)
+      _compressionBuffer.resize(maxFrameSize);
+
+   uint64_t startTime = j9thread_get_self_cpu_time(j9thread_self());
+   uLongf deflatedSize = maxFrameSize - COMPRESSED_HEADER_SIZE;
+   int rc = compress2((Bytef *)_compressionBuffer.data() + COMPRESSED_HEADER_SIZE, &deflatedSize,
+                      (const Bytef *)serialMsg, serializedSize, Z_BEST_SPEED);
+   _compressionCPUTime += j9thread_get_self_cpu_time(j9thread_self()) - startTime;
+
+   // Send the message uncompressed if compression does not save anything
+   uint32_t frameSize = COMPRESSED_HEADER_SIZE + deflatedSize;
+   if ((rc != Z_OK) || (frameSize >= serializedSize))
+      return false;
+
+   ((uint32_t *)_compressionBuffer.data())[0] = frameSize | COMPRESSED_MESSAGE_FLAG;
+   ((uint32_t *)_compressionBuffer.data())[1] = serializedSize;
+   writeBlocking(_compressionBuffer.data(), frameSize);
+
+   _numMessagesCompressed++;
+   _numBytesBeforeCompression += serializedSize;
+   _numBytesAfterCompression += frameSize;
+   return true;
+   }
+
 void
 CommunicationStream::writeMessage(Message &msg)
    {
    char *serialMsg = msg.serialize();
+   uint32_t serializedSize = msg.serializedSize();
+   if (_peerAcceptsCompression &&
+       (serializedSize >= TR::Options::_jitserverMessageCompressionThreshold) &&
+       writeCompressedMessage(serialMsg, serializedSize))
+      {
+      msg.clearForWrite();
+      return;
+      }
    // write serialized message to the socket
-   writeBlocking(serialMsg, msg.serializedSize());
+   writeBlocking(serialMsg, serializedSize);
    msg.clearForWrite();
    }
 }
@@ -40,6 +40,16 @@ enum JITServerCompatibilityFlags
    JITServerCompressedRef      = 0x00001000,
    };
 
+// Optional features that a side advertises in the configuration word of its messages:
+// the client in the message that carries the version check, the server in all of its
+// messages once that check has passed. Unlike JITServerCompatibilityFlags, they are
+// excluded from the version comparison and do not have to match.
+enum JITServerCapabilityFlags
+   {
+   JITServerAcceptsCompression = 0x80000000,
+   JITServerCapabilityMask     = 0xFF000000,
+   };
+
 class CommunicationStream
    {
 public:
@@ -68,8 +78,16 @@ public:
       TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "JITServer version: %u.%u.%u", MAJOR_NUMBER, MINOR_NUMBER, PATCH_NUMBER);
       }
 
+   // Statistics about message compression, summed over all streams.
+   // They are updated without synchronization, so they are approximate.
+   static uint64_t getNumMessagesCompressed() { return _numMessagesCompressed; }
+   static uint64_t getNumBytesBeforeCompression() { return _numBytesBeforeCompression; }
+   static uint64_t getNumBytesAfterCompression() { return _numBytesAfterCompression; }
+   static uint64_t getCompressionCPUTime() { return _compressionCPUTime; } // ns
+   static uint64_t getDecompressionCPUTime() { return _decompressionCPUTime; } // ns
+
 protected:
-   CommunicationStream() : _ssl(NULL), _connfd(-1) { }
+   CommunicationStream() : _ssl(NULL), _connfd(-1), _peerAcceptsCompression(false) { }
 
    virtual ~CommunicationStream()
       {
@@ -101,12 +119,38 @@ protected:
    ServerMessage _sMsg;
    ClientMessage _cMsg;
 
+   // Returns the JITServerCapabilityFlags supported by this side
+   static uint32_t getCapabilityFlags();
+   // Enable the optional features advertised by the other side that this side supports as well
+   void enableCapabilities(uint32_t peerCapabilityFlags);
+
+   // A side only compresses its messages once the other side has advertised
+   // JITServerAcceptsCompression, which happens after the version check has passed.
+   // The most significant bit of the size that starts a message then signals compression.
+   // A compressed message is sent as: size | COMPRESSED_MESSAGE_FLAG, uncompressed size, deflated message
+   static const uint32_t COMPRESSED_MESSAGE_FLAG  = 0x80000000;
+   static const uint32_t MESSAGE_SIZE_MASK        = 0x7FFFFFFF;
+   static const uint32_t COMPRESSED_HEADER_SIZE   = 2 * sizeof(uint32_t);
+
+   bool _peerAcceptsCompression; // the other side has advertised that it can receive compressed messages
+
    static const uint8_t MAJOR_NUMBER = 1;
-   static const uint16_t MINOR_NUMBER = 23;
+   static const uint16_t MINOR_NUMBER = 31;
    static const uint8_t PATCH_NUMBER = 0;
    static uint32_t CONFIGURATION_FLAGS;
 
 private:
+   void readCompressedMessage(Message &msg, uint32_t frameSize, uint32_t bytesRead);
+   bool writeCompressedMessage(const char *serialMsg, uint32_t serializedSize);
+
+   std::vector<char> _compressionBuffer; // scratch space for the compressed form of a message
+
+   static uint64_t _numMessagesCompressed;
+   static uint64_t _numBytesBeforeCompression;
+   static uint64_t _numBytesAfterCompression;
+   static uint64_t _compressionCPUTime;
+   static uint64_t _decompressionCPUTime;
+
    // readBlocking and writeBlocking are functions that directly read/write
    // passed object from/to the socket. For the object to be correctly written,
    // it needs to be contiguous.
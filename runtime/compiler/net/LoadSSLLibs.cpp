@@ -69,6 +69,8 @@ OSSL_accept_t * OSSL_accept = NULL;
 OSSL_connect_t * OSSL_connect = NULL;
 OSSL_get_peer_certificate_t * OSSL_get_peer_certificate = NULL;
 OSSL_get_verify_result_t * OSSL_get_verify_result = NULL;
+OSSL_set_session_t * OSSL_set_session = NULL;
+OSSL_SESSION_free_t * OSSL_SESSION_free = NULL;
 
 OSSL_CTX_new_t * OSSL_CTX_new = NULL;
 OSSL_CTX_set_session_id_context_t * OSSL_CTX_set_session_id_context = NULL;
@@ -78,6 +80,7 @@ OSSL_CTX_check_private_key_t * OSSL_CTX_check_private_key = NULL;
 OSSL_CTX_set_verify_t * OSSL_CTX_set_verify = NULL;
 OSSL_CTX_free_t * OSSL_CTX_free = NULL;
 OSSL_CTX_get_cert_store_t * OSSL_CTX_get_cert_store = NULL;
+OSSL_CTX_sess_set_new_cb_t * OSSL_CTX_sess_set_new_cb = NULL;
 
 OBIO_new_mem_buf_t * OBIO_new_mem_buf = NULL;
 OBIO_free_all_t * OBIO_free_all = NULL;
@@ -317,6 +320,8 @@ void dbgPrintSymbols()
    printf(" SSL_connect %p\n", OSSL_connect);
    printf(" SSL_get_peer_certificate %p\n", OSSL_get_peer_certificate);
    printf(" SSL_get_verify_result %p\n", OSSL_get_verify_result);
+   printf(" SSL_set_session %p\n", OSSL_set_session);
+   printf(" SSL_SESSION_free %p\n", OSSL_SESSION_free);
 
    printf(" SSL_CTX_new %p\n", OSSL_CTX_new);
    printf(" SSL_CTX_set_session_id_context %p\n", OSSL_CTX_set_session_id_context);
@@ -326,6 +331,7 @@ void dbgPrintSymbols()
    printf(" SSL_CTX_set_verify %p\n", OSSL_CTX_set_verify);
    printf(" SSL_CTX_free %p\n", OSSL_CTX_free);
    printf(" SSL_CTX_get_cert_store %p\n", OSSL_CTX_get_cert_store);
+   printf(" SSL_CTX_sess_set_new_cb %p\n", OSSL_CTX_sess_set_new_cb);
 
    printf(" BIO_new_mem_buf %p\n", OBIO_new_mem_buf);
    printf(" BIO_free_all %p\n", OBIO_free_all);
@@ -437,6 +443,8 @@ bool loadLibsslAndFindSymbols()
    OSSL_connect = (OSSL_connect_t *)findLibsslSymbol(handle, "SSL_connect");
    OSSL_get_peer_certificate = (OSSL_get_peer_certificate_t *)findLibsslSymbol(handle, "SSL_get_peer_certificate");
    OSSL_get_verify_result = (OSSL_get_verify_result_t *)findLibsslSymbol(handle, "SSL_get_verify_result");
+   OSSL_set_session = (OSSL_set_session_t *)findLibsslSymbol(handle, "SSL_set_session");
+   OSSL_SESSION_free = (OSSL_SESSION_free_t *)findLibsslSymbol(handle, "SSL_SESSION_free");
 
    OSSL_CTX_new = (OSSL_CTX_new_t *)findLibsslSymbol(handle, "SSL_CTX_new");
    OSSL_CTX_set_session_id_context = (OSSL_CTX_set_session_id_context_t *)findLibsslSymbol(handle, "SSL_CTX_set_session_id_context");
@@ -446,6 +454,7 @@ bool loadLibsslAndFindSymbols()
    OSSL_CTX_set_verify = (OSSL_CTX_set_verify_t *)findLibsslSymbol(handle, "SSL_CTX_set_verify");
    OSSL_CTX_free = (OSSL_CTX_free_t *)findLibsslSymbol(handle, "SSL_CTX_free");
    OSSL_CTX_get_cert_store = (OSSL_CTX_get_cert_store_t *)findLibsslSymbol(handle, "SSL_CTX_get_cert_store");
+   OSSL_CTX_sess_set_new_cb = (OSSL_CTX_sess_set_new_cb_t *)findLibsslSymbol(handle, "SSL_CTX_sess_set_new_cb");
 
    OBIO_new_mem_buf = (OBIO_new_mem_buf_t *)findLibsslSymbol(handle, "BIO_new_mem_buf");
    OBIO_free_all = (OBIO_free_all_t *)findLibsslSymbol(handle, "BIO_free_all");
@@ -505,6 +514,8 @@ bool loadLibsslAndFindSymbols()
        (OSSL_connect == NULL) ||
        (OSSL_get_peer_certificate == NULL) ||
        (OSSL_get_verify_result == NULL) ||
+       (OSSL_set_session == NULL) ||
+       (OSSL_SESSION_free == NULL) ||
 
        (OSSL_CTX_new == NULL) ||
        (OSSL_CTX_set_session_id_context == NULL) ||
@@ -514,6 +525,7 @@ bool loadLibsslAndFindSymbols()
        (OSSL_CTX_set_verify == NULL) ||
        (OSSL_CTX_free == NULL) ||
        (OSSL_CTX_get_cert_store == NULL) ||
+       (OSSL_CTX_sess_set_new_cb == NULL) ||
 
        (OBIO_new_mem_buf == NULL) ||
        (OBIO_free_all == NULL) ||
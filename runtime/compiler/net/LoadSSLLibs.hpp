@@ -65,6 +65,8 @@ typedef int OSSL_accept_t(SSL *ssl);
 typedef int OSSL_connect_t(SSL *ssl);
 typedef X509 * OSSL_get_peer_certificate_t(const SSL *ssl);
 typedef long OSSL_get_verify_result_t(const SSL *ssl);
+typedef int OSSL_set_session_t(SSL *ssl, SSL_SESSION *session);
+typedef void OSSL_SESSION_free_t(SSL_SESSION *session);
 
 typedef SSL_CTX * OSSL_CTX_new_t(const SSL_METHOD *method);
 typedef int OSSL_CTX_set_session_id_context_t(SSL_CTX *ctx, const unsigned char *sid_ctx, unsigned int sid_ctx_len);
@@ -74,6 +76,7 @@ typedef int OSSL_CTX_check_private_key_t(const SSL_CTX *ctx);
 typedef void OSSL_CTX_set_verify_t(SSL_CTX *ctx, int mode, int (*verify_callback)(int, X509_STORE_CTX *));
 typedef void OSSL_CTX_free_t(SSL_CTX *ctx);
 typedef X509_STORE * OSSL_CTX_get_cert_store_t(const SSL_CTX *ctx);
+typedef void OSSL_CTX_sess_set_new_cb_t(SSL_CTX *ctx, int (*new_session_cb)(SSL *, SSL_SESSION *));
 
 typedef BIO * OBIO_new_mem_buf_t(const void *buf, int len);
 typedef void OBIO_free_all_t(BIO *a);
@@ -129,6 +132,8 @@ extern "C" OSSL_accept_t * OSSL_accept;
 extern "C" OSSL_connect_t * OSSL_connect;
 extern "C" OSSL_get_peer_certificate_t * OSSL_get_peer_certificate;
 extern "C" OSSL_get_verify_result_t * OSSL_get_verify_result;
+extern "C" OSSL_set_session_t * OSSL_set_session;
+extern "C" OSSL_SESSION_free_t * OSSL_SESSION_free;
 
 extern "C" OSSLv23_server_method_t * OSSLv23_server_method;
 extern "C" OSSLv23_client_method_t * OSSLv23_client_method;
@@ -141,6 +146,7 @@ extern "C" OSSL_CTX_check_private_key_t * OSSL_CTX_check_private_key;
 extern "C" OSSL_CTX_set_verify_t * OSSL_CTX_set_verify;
 extern "C" OSSL_CTX_free_t * OSSL_CTX_free;
 extern "C" OSSL_CTX_get_cert_store_t * OSSL_CTX_get_cert_store;
+extern "C" OSSL_CTX_sess_set_new_cb_t * OSSL_CTX_sess_set_new_cb;
 
 extern "C" OBIO_new_mem_buf_t * OBIO_new_mem_buf;
 extern "C" OBIO_free_all_t * OBIO_free_all;
@@ -21,6 +21,7 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
  *******************************************************************************/
 
+#include <string.h>
 #include "net/Message.hpp"
 #include "infra/Assert.hpp"
 #include "env/VerboseLog.hpp"
@@ -90,6 +91,22 @@ Message::deserialize()
       }
    }
 
+void
+Message::deserializeFromString(const std::string &serialMsg)
+   {
+   clearForRead();
+
+   uint32_t serializedSize = serialMsg.size();
+   TR_ASSERT_FATAL(serializedSize >= sizeof(uint32_t) + sizeof(MetaData), "Embedded message is too small: %u bytes", serializedSize);
+   TR_ASSERT_FATAL(*reinterpret_cast<const uint32_t *>(serialMsg.data()) == serializedSize, "Embedded message size mismatch");
+
+   expandBufferIfNeeded(serializedSize);
+   setSerializedSize(serializedSize);
+   memcpy(getBufferStartForRead() + sizeof(uint32_t), serialMsg.data() + sizeof(uint32_t), serializedSize - sizeof(uint32_t));
+
+   deserialize();
+   }
+
 uint32_t
 Message::DataDescriptor::print(uint32_t nestingLevel)
    {
@@ -23,6 +23,7 @@
 #ifndef MESSAGE_H
 #define MESSAGE_H
 
+#include <string>
 #include <vector>
 #include <stdlib.h>
 #include "net/MessageBuffer.hpp"
@@ -321,6 +322,27 @@ public:
    */
    void deserialize();
 
+   /**
+      @brief Serialize the message into a string.
+
+      Used to embed a complete message as a single data point of a
+      `batchedRequests` message.
+
+      @return A string holding the serialized message
+   */
+   std::string serializeToString()
+      {
+      char *serialMsg = serialize();
+      return std::string(serialMsg, serializedSize());
+      }
+
+   /**
+      @brief Rebuild the message from a string produced by serializeToString()
+
+      The previous content of the message is discarded.
+   */
+   void deserializeFromString(const std::string &serialMsg);
+
    /**
       @brief Set serialized size of the message
    */
@@ -383,6 +405,11 @@ protected:
 
 class ServerMessage : public Message
    {
+public:
+   // The server has no version to report, so the configuration word
+   // carries the JITServerCapabilityFlags that it supports
+   uint32_t capabilityFlags() const { return getMetaData()->_config; }
+   void setCapabilityFlags(uint32_t flags) { getMetaData()->_config = flags; }
    };
 
 class ClientMessage : public Message
@@ -34,10 +34,12 @@ enum MessageType : uint16_t
    mirrorResolvedJ9Method,
    get_params_to_construct_TR_j9method,
    getUnloadedClassRangesAndCHTable,
+   getMissingCriticalUpdates, // type used by the server to recover the updates of critical requests that did not arrive
    compilationRequest, // type used when client sends remote compilation requests
    compilationInterrupted, // type used when client informs the server to abort the remote compilation
    clientSessionTerminate, // type used when client process is about to terminate
    connectionTerminate, // type used when client informs the server to close the connection
+   batchedRequests, // type used for a batch of independent queries, and for the combined answer to them
 
    // For TR_ResolvedJ9JITServerMethod methods
    ResolvedMethod_setRecognizedMethodInfo,
@@ -281,10 +283,12 @@ static const char *messageNames[] =
    "mirrorResolvedJ9Method",
    "get_params_to_construct_TR_j9method",
    "getUnloadedClassRangesAndCHTable",
+   "getMissingCriticalUpdates",
    "compilationRequest",
    "compilationInterrupted",
    "clientSessionTerminate",
    "connectionTerminate",
+   "batchedRequests",
    "ResolvedMethod_setRecognizedMethodInfo",
    "ResolvedMethod_startAddressForInterpreterOfJittedMethod",
    "ResolvedMethod_staticAttributes",
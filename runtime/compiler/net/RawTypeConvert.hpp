@@ -315,6 +315,20 @@ void setArgsRaw(Message &message, Args&... args)
    SetArgsRaw<Args...>::setArgs(message, args...);
    }
 
+// setArgsRawFromTuple fills out a message with the elements of a tuple,
+// as if they had been passed to setArgsRaw individually.
+template <typename... Args, size_t... Idx>
+void setArgsRawFromTupleImpl(Message &message, std::tuple<Args...> &args, index_tuple_raw<Idx...>)
+   {
+   setArgsRaw<Args...>(message, std::get<Idx>(args)...);
+   }
+template <typename... Args>
+void setArgsRawFromTuple(Message &message, std::tuple<Args...> &args)
+   {
+   using Idx = typename index_tuple_gen_raw<sizeof...(Args)>::type;
+   setArgsRawFromTupleImpl(message, args, Idx());
+   }
+
 template <typename Arg1, typename... Args>
 struct GetArgsRaw
    {
@@ -33,5 +33,7 @@ ServerStream::ServerStream(int connfd, BIO *ssl)
    initStream(connfd, ssl);
    _numConnectionsOpened++;
    _pClientSessionData = NULL;
+   _batchType = MessageType_MAXTYPE;
+   _versionCheckPassed = false;
    }
 }
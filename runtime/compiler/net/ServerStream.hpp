@@ -58,6 +58,9 @@ namespace JITServer
    6) At this point the server could query the client with:
          stream->write(MessageType type, T... args);
          auto recv = stream->read<....>();
+      Independent queries of the same type can be sent in a single round trip with:
+         stream->writeBatch(MessageType type, std::vector<std::tuple<T...>> requests);
+         auto recv = stream->readBatch<....>(requests.size());
    7) When compilation is completed successfully, the server responds with finishCompilation(T... args).
       When compilation is aborted, the sever responds with writeError(uint32_t statusCode).
  */
@@ -101,6 +104,8 @@ public:
 
       _sMsg.setType(type);
       setArgsRaw<Args...>(_sMsg, args...);
+      // Only advertise capabilities after the client has passed the version check
+      _sMsg.setCapabilityFlags(_versionCheckPassed ? getCapabilityFlags() : 0);
       writeMessage(_sMsg);
       }
 
@@ -140,6 +145,70 @@ public:
       return getArgsRaw<T...>(_cMsg);
       }
 
+   /**
+      @brief Send several independent queries of the same type to the client in a single message
+
+      Each element of `requests` holds the arguments of one query, exactly as they would
+      be passed to write(type, args...). The client answers all of the queries with a single
+      reply, which must be consumed with readBatch(). This saves one network round trip
+      per query, so it should be used when the server knows up front that it needs the
+      answers to a group of queries, e.g. the class info for all the classes referenced
+      by a constant pool.
+
+      The queries in a batch must not depend on each other's answers, and the client handler
+      for the message type must answer with exactly one write() and no further reads.
+
+      @param [in] type Message type of every query in the batch
+      @param [in] requests Arguments of each query in the batch
+   */
+   template <typename ...Args>
+   void writeBatch(MessageType type, const std::vector<std::tuple<Args...>> &requests)
+      {
+      std::vector<std::string> serialRequests;
+      serialRequests.reserve(requests.size());
+      for (auto &request : requests)
+         {
+         std::tuple<Args...> args = request;
+         _batchMsg.clearForWrite();
+         _batchMsg.setType(type);
+         setArgsRawFromTuple<Args...>(_batchMsg, args);
+         serialRequests.push_back(_batchMsg.serializeToString());
+         }
+      _batchType = type;
+      write(MessageType::batchedRequests, serialRequests);
+      }
+
+   /**
+      @brief Read the answers to a batch of queries sent with writeBatch()
+
+      Exceptions are thrown under the same conditions as read(). In addition,
+      StreamArityMismatch is thrown if the client answered a different number
+      of queries than the number sent, and StreamMessageTypeMismatch is thrown
+      if any answer does not match the type of the queries.
+
+      @param [in] expectedNumReplies Number of queries sent in the batch
+      @return Returns a vector with one tuple of arguments per query, in the order the queries were sent
+   */
+   template <typename ...T>
+   std::vector<std::tuple<T...>> readBatch(size_t expectedNumReplies)
+      {
+      auto recv = read<std::vector<std::string>>();
+      auto &serialReplies = std::get<0>(recv);
+      if (serialReplies.size() != expectedNumReplies)
+         throw StreamArityMismatch("Received " + std::to_string(serialReplies.size()) + " replies to a batch of " + std::to_string(expectedNumReplies) + " requests");
+
+      std::vector<std::tuple<T...>> replies;
+      replies.reserve(serialReplies.size());
+      for (auto &serialReply : serialReplies)
+         {
+         _batchMsg.deserializeFromString(serialReply);
+         if (_batchMsg.type() != _batchType)
+            throw StreamMessageTypeMismatch(_batchType, _batchMsg.type());
+         replies.push_back(getArgsRaw<T...>(_batchMsg));
+         }
+      return replies;
+      }
+
    /**
       @brief Function to read the compilation request from a client
 
@@ -158,9 +227,16 @@ public:
    std::tuple<T...> readCompileRequest()
       {
       readMessage(_cMsg);
-      if (_cMsg.fullVersion() != 0 && _cMsg.fullVersion() != getJITServerFullVersion())
+      uint64_t clientFullVersion = _cMsg.fullVersion();
+      if (clientFullVersion != 0)
          {
-         throw StreamVersionIncompatible(getJITServerFullVersion(), _cMsg.fullVersion());
+         // Capabilities are optional and are not part of the compatibility check
+         uint32_t clientCapabilityFlags = (uint32_t)(clientFullVersion >> 32) & JITServerCapabilityMask;
+         clientFullVersion &= ~((uint64_t)JITServerCapabilityMask << 32);
+         if (clientFullVersion != getJITServerFullVersion())
+            throw StreamVersionIncompatible(getJITServerFullVersion(), clientFullVersion);
+         _versionCheckPassed = true;
+         enableCapabilities(clientCapabilityFlags);
          }
 
       switch (_cMsg.type())
@@ -247,6 +323,16 @@ public:
       _pClientSessionData = pClientData;
       }
 
+   // Socket descriptor used by the listener to wait for the next compilation request on this stream
+   int getSocketFD() const { return getConnFD(); }
+
+   // Returns true if part of the next message has already been read from the socket by the SSL layer,
+   // in which case waiting for the socket to become readable could block indefinitely
+   bool hasBufferedInput() const
+      {
+      return _ssl && ((*OBIO_ctrl)(_ssl, BIO_CTRL_PENDING, 0, NULL) > 0);
+      }
+
    volatile bool isReadingClassUnload()
       {
       return (_pClientSessionData) ? _pClientSessionData->isReadingClassUnload() : false;
@@ -265,6 +351,9 @@ private:
    static int _numConnectionsOpened;
    static int _numConnectionsClosed;
    uint64_t _clientId;  // UID of client connected to this communication stream
+   Message _batchMsg; // Scratch message used to (de)serialize the elements of a batch
+   MessageType _batchType; // Type of the queries in the last batch sent with writeBatch()
+   bool _versionCheckPassed; // a compilation request on this stream has passed the version check
    ClientSessionData *_pClientSessionData;
    };
 
@@ -30,6 +30,7 @@
 #include <algorithm>
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include "codegen/CodeGenerator.hpp"
 #include "env/FrontEnd.hpp"
@@ -1881,13 +1882,42 @@ bool TR_EscapeAnalysis::isEscapePointCold(Candidate *candidate, TR::Node *node)
    if (!disableColdEsc &&
        (_inColdBlock ||
         (candidate->isInsideALoop() &&
-         (candidate->_block->getFrequency() > 4*_curBlock->getFrequency()))) &&
+         (candidate->_block->getFrequency() > 4*_curBlock->getFrequency())) ||
+        isEscapePointRarelyExecuted(candidate)) &&
        (candidate->_origKind == TR::New))
       return true;
 
    return false;
    }
 
+// An escape point outside a loop that is not marked cold can still be worth
+// heapifying at, if profiling shows its block runs far less often than the
+// allocation itself: the object is then only materialized on that rare path.
+//
+bool TR_EscapeAnalysis::isEscapePointRarelyExecuted(Candidate *candidate)
+   {
+   static const char *coldEscapeRatioStr = feGetEnv("TR_ColdEscapeFrequencyRatio");
+   static const int32_t coldEscapeRatio = coldEscapeRatioStr ? atoi(coldEscapeRatioStr) : 16;
+
+   if (coldEscapeRatio <= 0 || candidate->isInsideALoop())
+      return false;
+
+   int32_t allocationFrequency = candidate->_block->getFrequency();
+   int32_t escapeFrequency = _curBlock->getFrequency();
+
+   // Frequencies at or below the cold threshold carry no profiling information
+   if (allocationFrequency <= (MAX_COLD_BLOCK_COUNT+1) || escapeFrequency < 0)
+      return false;
+
+   if (allocationFrequency <= coldEscapeRatio*escapeFrequency)
+      return false;
+
+   if (trace())
+      traceMsg(comp(), "   Escape point in block_%d (freq %d) is rarely executed relative to candidate [%p] in block_%d (freq %d)\n",
+         _curBlock->getNumber(), escapeFrequency, candidate->_node, candidate->_block->getNumber(), allocationFrequency);
+   return true;
+   }
+
 
 void TR_EscapeAnalysis::checkDefsAndUses()
    {
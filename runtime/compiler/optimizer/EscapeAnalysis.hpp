@@ -555,6 +555,7 @@ class TR_EscapeAnalysis : public TR::Optimization
    bool     checkIfUseIsInSameLoopAsDef(TR::TreeTop *defTree, TR::Node *useNode);
 
    bool     isEscapePointCold(Candidate *candidate, TR::Node *node);
+   bool     isEscapePointRarelyExecuted(Candidate *candidate);
    bool     checkIfEscapePointIsCold(Candidate *candidate, TR::Node *node);
    void     forceEscape(TR::Node *node, TR::Node *reason, bool forceFail = false);
    bool     restrictCandidates(TR::Node *node, TR::Node *reason, restrictionType);
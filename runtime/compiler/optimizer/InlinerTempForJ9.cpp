@@ -61,6 +61,8 @@
 #include "env/VMJ9.h"
 #include "runtime/J9Profiler.hpp"
 #include "ras/DebugCounter.hpp"
+#include "runtime/CodeCacheManager.hpp"
+#include "control/CompilationRuntime.hpp"
 #include "j9consts.h"
 #include "optimizer/TransformUtil.hpp"
 
@@ -385,6 +387,17 @@ TR_J9InlinerPolicy::alwaysWorthInlining(TR_ResolvedMethod * calleeMethod, TR::No
       case TR::java_nio_ByteOrder_nativeOrder:
          return true;
 
+      // The VectorSupport entry points are not intrinsified; their Java implementation just
+      // invokes the default-implementation lambda passed by the caller. Inlining the entry point
+      // lets that lambda call be devirtualized and exposes the VectorPayload boxes to escape analysis
+      case TR::jdk_internal_vm_vector_VectorSupport_binaryOp:
+      case TR::jdk_internal_vm_vector_VectorSupport_load:
+      case TR::jdk_internal_vm_vector_VectorSupport_store:
+      case TR::jdk_internal_vm_vector_VectorSupport_compare:
+      case TR::jdk_internal_vm_vector_VectorSupport_blend:
+      case TR::jdk_internal_vm_vector_VectorSupport_reductionCoerced:
+         return true;
+
       // In Java9 the following enum values match both sun.misc.Unsafe and
       // jdk.internal.misc.Unsafe The sun.misc.Unsafe methods are simple
       // wrappers to call jdk.internal impls, and we want to inline them. Since
@@ -4576,11 +4589,60 @@ TR_J9InlinerUtil::refineInlineGuard(TR::Node *callNode, TR::Block *&block1, TR::
       }
    }
 
+// The static inlining thresholds do not account for how much code cache is left
+// or for how backed up the compilation queue is. Returns the percentage of the
+// normal budget the inliner should use: 100 when there is no pressure, shrinking
+// linearly to 25 as the code cache fills up, and capped while the queue is long.
+static int32_t
+inliningBudgetPercent(TR::Compilation *comp)
+   {
+   int32_t percent = 100;
+   J9JITConfig *jitConfig = comp->fej9()->getJ9JITConfig();
+
+   // On the server the code cache that matters belongs to the client
+   bool isOutOfProcessCompilation = false;
+#if defined(J9VM_OPT_JITSERVER)
+   isOutOfProcessCompilation = comp->isOutOfProcessCompilation();
+#endif /* defined(J9VM_OPT_JITSERVER) */
+   int32_t usageThreshold = TR::Options::_codeCacheUsagePercentToShrinkInlining;
+   if (usageThreshold > 0 && usageThreshold < 100 && !isOutOfProcessCompilation && jitConfig->codeCacheTotalKB > 0)
+      {
+      int32_t usedPercent = (int32_t)std::min<uint64_t>(100,
+         (uint64_t)(TR::CodeCacheManager::instance()->getCurrTotalUsedInBytes() / 1024) * 100 / jitConfig->codeCacheTotalKB);
+      if (usedPercent > usageThreshold)
+         percent = 100 - (75 * (usedPercent - usageThreshold)) / (100 - usageThreshold);
+      }
+
+   int32_t qszThreshold = TR::Options::_qszThresholdToDowngradeOptLevel;
+   if (qszThreshold > 0)
+      {
+      int32_t queueSize = getCompilationInfo(jitConfig)->getMethodQueueSize();
+      if (queueSize >= 2 * qszThreshold)
+         percent = std::min(percent, 50);
+      else if (queueSize >= qszThreshold)
+         percent = std::min(percent, 75);
+      }
+
+   return percent;
+   }
+
 void
 TR_J9InlinerUtil::refineInliningThresholds(TR::Compilation *comp, int32_t &callerWeightLimit, int32_t &maxRecursiveCallByteCodeSizeEstimate, int32_t &methodByteCodeSizeThreshold, int32_t &methodInWarmBlockByteCodeSizeThreshold, int32_t &methodInColdBlockByteCodeSizeThreshold, int32_t &nodeCountThreshold, int32_t size)
    {
    comp->fej9()->setInlineThresholds(comp, callerWeightLimit, maxRecursiveCallByteCodeSizeEstimate, methodByteCodeSizeThreshold,
          methodInWarmBlockByteCodeSizeThreshold, methodInColdBlockByteCodeSizeThreshold, nodeCountThreshold, size);
+
+   int32_t budgetPercent = inliningBudgetPercent(comp);
+   if (budgetPercent < 100)
+      {
+      callerWeightLimit = callerWeightLimit * budgetPercent / 100;
+      maxRecursiveCallByteCodeSizeEstimate = maxRecursiveCallByteCodeSizeEstimate * budgetPercent / 100;
+      methodByteCodeSizeThreshold = methodByteCodeSizeThreshold * budgetPercent / 100;
+      methodInWarmBlockByteCodeSizeThreshold = methodInWarmBlockByteCodeSizeThreshold * budgetPercent / 100;
+      methodInColdBlockByteCodeSizeThreshold = methodInColdBlockByteCodeSizeThreshold * budgetPercent / 100;
+      if (comp->trace(OMR::inlining))
+         traceMsg(comp, "Inlining budget reduced to %d%% because of code cache or compilation queue pressure\n", budgetPercent);
+      }
    }
 
 bool
@@ -478,7 +478,7 @@ bool TR_SPMDKernelParallelizer::visitTreeTopToSIMDize(TR::TreeTop *tt, TR_SPMDKe
                {
                //isReduction is run to check that the reduction matches the reduction pattern
                //-only uses the reduction symref once
-               //-reduction operation is supported (currently only add and mul)
+               //-reduction operation is supported (add, mul and integral and/or/xor)
                //-only the reduction operation is used between the store node and the reduction variable load
                if (isReduction(comp, loop, node->getFirstChild(), reductionInfo, reductionInfo->reductionOp))
                   {
@@ -1026,7 +1026,7 @@ bool TR_SPMDKernelParallelizer::autoSIMDReductionSupported(TR::Compilation *comp
 
 //isReduction is run to check that the reduction matches the reduction pattern
 //-only uses the reduction symref once
-//-reduction operation is support (currently only add and mul)
+//-reduction operation is supported (add and mul, plus and/or/xor for integral types)
 //-only the reduction operation is used between the store node and the reduction variable load
 bool TR_SPMDKernelParallelizer::isReduction(TR::Compilation *comp, TR_RegionStructure *loop, TR::Node *node, TR_SPMDReductionInfo* reductionInfo, TR_SPMDReductionOp pathOp)
    {
@@ -1059,7 +1059,7 @@ bool TR_SPMDKernelParallelizer::isReduction(TR::Compilation *comp, TR_RegionStru
       else
          return false;
       }
-   else if (opCode.isAdd() || opCode.isMul() || opCode.isSub()) //TODO: add max, min and bitwise operations here
+   else if (opCode.isAdd() || opCode.isMul() || opCode.isSub() || opCode.isAnd() || opCode.isOr() || opCode.isXor()) //TODO: add max and min here
       {
       if (opCode.isAdd() || opCode.isSub()) //sub is a special case of add. It only works if the reduction var is on the left
          {
@@ -1087,6 +1087,14 @@ bool TR_SPMDKernelParallelizer::isReduction(TR::Compilation *comp, TR_RegionStru
                return false;
             }
          }
+      else if (node->getDataType().isIntegral()) //bitwise ops are associative and commutative, so lane-wise partial results combine exactly
+         {
+         TR_SPMDReductionOp bitwiseOp = opCode.isAnd() ? Reduction_And : (opCode.isOr() ? Reduction_Or : Reduction_Xor);
+         if (pathOp == Reduction_OpUninitialized)
+            pathOp = bitwiseOp;
+         else if (pathOp != bitwiseOp)
+            return false;
+         }
       else
          {
          return false;
@@ -1146,7 +1154,7 @@ bool TR_SPMDKernelParallelizer::noReductionVar(TR::Compilation *comp, TR_RegionS
       else
          return true;
       }
-   else if (opCode.isAdd() || opCode.isSub() || opCode.isMul() || opCode.isDiv() || opCode.isRem()) //TODO: add max, min and bitwise operations here
+   else if (opCode.isAdd() || opCode.isSub() || opCode.isMul() || opCode.isDiv() || opCode.isRem() || opCode.isAnd() || opCode.isOr() || opCode.isXor()) //TODO: add max and min here
       {
       TR::Node *firstChild = node->getFirstChild();
       TR::Node *secondChild = node->getSecondChild();
@@ -1168,6 +1176,39 @@ bool TR_SPMDKernelParallelizer::noReductionVar(TR::Compilation *comp, TR_RegionS
    return false;
    }
 
+bool TR_SPMDKernelParallelizer::isSupportedReductionOp(TR_SPMDReductionOp reductionOp)
+   {
+   switch (reductionOp)
+      {
+      case Reduction_Add:
+      case Reduction_Mul:
+      case Reduction_And:
+      case Reduction_Or:
+      case Reduction_Xor:
+         return true;
+      default:
+         return false;
+      }
+   }
+
+//returns the scalar opcode used to combine the vector lanes of a bitwise reduction
+TR::ILOpCodes TR_SPMDKernelParallelizer::bitwiseReductionOpCode(TR_SPMDReductionOp reductionOp, TR::DataType dt)
+   {
+   switch (dt)
+      {
+      case TR::Int8:
+         return reductionOp == Reduction_And ? TR::band : (reductionOp == Reduction_Or ? TR::bor : TR::bxor);
+      case TR::Int16:
+         return reductionOp == Reduction_And ? TR::sand : (reductionOp == Reduction_Or ? TR::sor : TR::sxor);
+      case TR::Int32:
+         return reductionOp == Reduction_And ? TR::iand : (reductionOp == Reduction_Or ? TR::ior : TR::ixor);
+      case TR::Int64:
+         return reductionOp == Reduction_And ? TR::land : (reductionOp == Reduction_Or ? TR::lor : TR::lxor);
+      default:
+         return TR::BadILOp;
+      }
+   }
+
 //initializes the reduction vector symref with the identity
 bool TR_SPMDKernelParallelizer::reductionLoopEntranceProcessing(TR::Compilation *comp, TR_RegionStructure *loop, TR::SymbolReference *symRef, TR::SymbolReference *vecSymRef, TR_SPMDReductionOp reductionOp)
    {
@@ -1178,8 +1219,7 @@ bool TR_SPMDKernelParallelizer::reductionLoopEntranceProcessing(TR::Compilation
    if (reductionOp == Reduction_OpUninitialized)
       return true; //Nothing needs to be done
 
-   //we only know how to handle add and multiply ops right now
-   if (!(reductionOp == Reduction_Add || reductionOp == Reduction_Mul))
+   if (!isSupportedReductionOp(reductionOp))
       {
       if (trace) traceMsg(comp, "   reductionLoopEntranceProcessing: Invalid or unknown reductionOp during transformation phase.\n");
       TR_ASSERT(0, "Invalid or unknown reductionOp during transformation phase");
@@ -1201,16 +1241,21 @@ bool TR_SPMDKernelParallelizer::reductionLoopEntranceProcessing(TR::Compilation
    //splat the identity for the initial value
    TR::Node *splatsNode = TR::Node::create(insertionPoint->getNode(), TR::vsplats, 1);
    TR::Node *constNode = TR::Node::create(insertionPoint->getNode(), splatConstType, 0);
-   uint8_t identity = 0;
+   int64_t identity = 0;
 
    switch (reductionOp)
       {
       case Reduction_Add: //identity is 0
+      case Reduction_Or:
+      case Reduction_Xor:
          identity = 0;
          break;
       case Reduction_Mul: //identity is 1
          identity = 1;
          break;
+      case Reduction_And: //identity is all bits set
+         identity = -1;
+         break;
       default:
          if (trace) traceMsg(comp, "   reductionLoopEntranceProcessing: Invalid or unknown reductionOp during transformation phase (2).\n");
          TR_ASSERT(0, "Invalid or unknown reductionOp during transformation phase (2)");
@@ -1220,22 +1265,22 @@ bool TR_SPMDKernelParallelizer::reductionLoopEntranceProcessing(TR::Compilation
    switch (scalarDataType)
       {
       case TR::Int8:
-         constNode->setByte(identity);
+         constNode->setByte((int8_t)identity);
          break;
       case TR::Int16:
-         constNode->setShortInt(identity);
+         constNode->setShortInt((int16_t)identity);
          break;
       case TR::Int32:
-         constNode->setInt(identity);
+         constNode->setInt((int32_t)identity);
          break;
       case TR::Int64:
          constNode->setLongInt(identity);
          break;
       case TR::Float:
-         constNode->setFloat(identity);
+         constNode->setFloat((float)identity);
          break;
       case TR::Double:
-         constNode->setDouble(identity);
+         constNode->setDouble((double)identity);
          break;
       default:
          if (trace) traceMsg(comp, "   reductionLoopEntranceProcessing: Unknown vector data type during transformation phase.\n");
@@ -1269,8 +1314,7 @@ bool TR_SPMDKernelParallelizer::reductionLoopExitProcessing(TR::Compilation *com
    if (reductionOp == Reduction_OpUninitialized)
       return true; //Nothing needs to be done
 
-   //we only know how to handle add and multiply ops right now
-   if (!(reductionOp == Reduction_Add || reductionOp == Reduction_Mul))
+   if (!isSupportedReductionOp(reductionOp))
       {
       if (trace) traceMsg(comp, "   reductionLoopExitProcessing: Invalid or unknown reductionOp during transformation phase.\n");
       TR_ASSERT(0, "Invalid or unknown reductionOp during transformation phase");
@@ -1287,6 +1331,11 @@ bool TR_SPMDKernelParallelizer::reductionLoopExitProcessing(TR::Compilation *com
       case Reduction_Mul:
          scalarReductionOp = TR::ILOpCode::multiplyOpCode(scalarDataType);
          break;
+      case Reduction_And:
+      case Reduction_Or:
+      case Reduction_Xor:
+         scalarReductionOp = bitwiseReductionOpCode(reductionOp, scalarDataType);
+         break;
       default:
          if (trace) traceMsg(comp, "   reductionLoopExitProcessing: Invalid or unknown reductionOp during transformation phase (2).\n");
          TR_ASSERT(0, "Invalid or unknown reductionOp during transformation phase (2)");
@@ -1362,7 +1411,6 @@ bool TR_SPMDKernelParallelizer::reductionLoopExitProcessing(TR::Compilation *com
       TR::TreeTop *insertionPoint = reductionBlock->getEntry();
 
       //read each element from the vector and perform the reduction operation to combine them
-      //only add and mult are supported right now
       TR::Node *loadVectorNode = TR::Node::create(insertionPoint->getNode(), TR::vload, 0);
       loadVectorNode->setSymbolReference(vecSymRef);
 
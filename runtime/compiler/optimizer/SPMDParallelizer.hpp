@@ -193,6 +193,9 @@ class TR_SPMDKernelParallelizer : public TR_LoopTransformer
       Reduction_Invalid, //the reduction uses multiple different operators or is unsupported for other reasons
       Reduction_Add,
       Reduction_Mul,
+      Reduction_And, //bitwise reductions are only recognized for integral types
+      Reduction_Or,
+      Reduction_Xor,
       };
 
    struct TR_SPMDReductionInfo
@@ -226,6 +229,8 @@ class TR_SPMDKernelParallelizer : public TR_LoopTransformer
    bool visitTreeTopToSIMDize(TR::TreeTop *tt, TR_SPMDKernelInfo *pSPMDInfo, bool isCheckMode, TR_RegionStructure *loop, CS2::ArrayOf<TR::Node *, TR::Allocator> &useNodesOfDefsInLoop, TR::Compilation *comp, TR_UseDefInfo *useDefInfo, SharedSparseBitVector &defsInLoop, SharedSparseBitVector* usesInLoop, TR_HashTab* reductionHashTab);
 
    bool autoSIMDReductionSupported(TR::Compilation *comp, TR::Node *node);
+   bool isSupportedReductionOp(TR_SPMDReductionOp reductionOp);
+   TR::ILOpCodes bitwiseReductionOpCode(TR_SPMDReductionOp reductionOp, TR::DataType dt);
    bool isReduction(TR::Compilation *comp, TR_RegionStructure *loop, TR::Node *node, TR_SPMDReductionInfo* reductionInfo, TR_SPMDReductionOp pathOp);
    bool noReductionVar(TR::Compilation *comp, TR_RegionStructure *loop, TR::Node *node, TR_SPMDReductionInfo* reductionInfo);
    bool reductionLoopEntranceProcessing(TR::Compilation *comp, TR_RegionStructure *loop, TR::SymbolReference *symRef, TR::SymbolReference *vecSymRef, TR_SPMDReductionOp reductionOp);
@@ -562,7 +562,8 @@ int32_t TR_StringBuilderTransformer::computeHeuristicStringBuilderInitCapacity(L
                   }
                else
                   {
-                  capacity += floor(log10(static_cast<double>(-value))) + 2;
+                  // Negate after the conversion so that the minimum value does not overflow
+                  capacity += floor(log10(-static_cast<double>(value))) + 2;
                   }
                }
             else
@@ -574,7 +575,7 @@ int32_t TR_StringBuilderTransformer::computeHeuristicStringBuilderInitCapacity(L
 
          case TR::java_lang_StringBuilder_append_long:
             {
-            if (argument->getOpCodeValue() == TR::iconst)
+            if (argument->getOpCodeValue() == TR::lconst)
                {
                int64_t value = argument->getLongInt();
 
@@ -588,7 +589,8 @@ int32_t TR_StringBuilderTransformer::computeHeuristicStringBuilderInitCapacity(L
                   }
                else
                   {
-                  capacity += floor(log10(static_cast<double>(-value))) + 2;
+                  // Negate after the conversion so that the minimum value does not overflow
+                  capacity += floor(log10(-static_cast<double>(value))) + 2;
                   }
                }
             else
@@ -889,6 +889,16 @@ TR_RuntimeAssumptionTable::notifyClassRedefinitionEvent(TR_FrontEnd *vm, bool is
       nop_cursor = nop_next;
       }
 
+   // Unresolved PIC assumptions are keyed by the unresolved constant pool entry rather than
+   // by the class they end up resolving to, so they can only be found by walking the whole table.
+   // Avoid the walk when no such assumption is live.
+   if (getAssumptionCount(RuntimeAssumptionOnClassRedefinitionUPIC) == getReclaimedAssumptionCount(RuntimeAssumptionOnClassRedefinitionUPIC))
+      {
+      if (reportDetails)
+         TR_VerboseLog::writeLineLocked(TR_Vlog_RA, "No unresolved PIC assumptions registered");
+      return;
+      }
+
    if (reportDetails)
       TR_VerboseLog::writeLineLocked(TR_Vlog_RA, "Scanning for unresolved PIC assumptions");
 
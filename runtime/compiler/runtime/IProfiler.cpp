@@ -38,6 +38,7 @@
 #include "rommeth.h"
 #include "vmaccess.h"
 #include "VMHelpers.hpp"
+#include "AtomicSupport.hpp"
 #include "control/Options.hpp"
 #include "control/Options_inlines.hpp"
 #include "compile/Compilation.hpp"
@@ -56,6 +57,7 @@
 #include "il/Node_inlines.hpp"
 #include "il/TreeTop.hpp"
 #include "il/TreeTop_inlines.hpp"
+#include "infra/CriticalSection.hpp"
 #include "infra/Monitor.hpp"
 #include "infra/MonitorTable.hpp"
 #include "infra/SimpleRegex.hpp"
@@ -73,7 +75,8 @@
 #include "runtime/J9Profiler.hpp"
 #include "omrformatconsts.h"
 
-#define BC_HASH_TABLE_SIZE  34501 // 131071// 34501
+#define BC_HASH_TABLE_INITIAL_BUCKETS 4096 // must be a power of two
+#define AGGREGATION_HASH_TABLE_SIZE   34501
 #undef  IPROFILER_CONTENDED_LOCKING
 #define ALLOC_HASH_TABLE_SIZE 1201
 #define TEST_verbose 0
@@ -458,6 +461,7 @@ TR_IProfiler::persistIprofileInfo(TR::ResolvedMethodSymbol *resolvedMethodSymbol
                      {
                      _STATS_methodPersisted++;
                      _STATS_entriesPersisted += numEntries;
+                     registerPersistedMethod(romMethod);
 #ifdef PERSISTENCE_VERBOSE
                      fprintf(stderr, "\tPersisted %d entries\n", numEntries);
 #endif
@@ -524,6 +528,8 @@ TR_IProfiler::persistIprofileInfo(TR::ResolvedMethodSymbol *resolvedMethodSymbol
          else
             {
             _STATS_methodNotPersisted_alreadyStored++;
+            // Another JVM may have stored it from a less representative profile
+            registerPersistedMethod(romMethod);
 #ifdef PERSISTENCE_VERBOSE
             fprintf(stderr, "\tNot Persisted: already stored\n");
 #endif
@@ -546,6 +552,137 @@ TR_IProfiler::persistIprofileInfo(TR::ResolvedMethodSymbol *resolvedMethodSymbol
       }
    }
 
+void
+TR_IProfiler::registerPersistedMethod(J9ROMMethod *romMethod)
+   {
+   if (!_persistedMethods)
+      return;
+
+   OMR::CriticalSection registerMethod(_persistedMethodsMonitor);
+   try
+      {
+      if (_persistedMethodsSet->insert(romMethod).second)
+         _persistedMethods->push_back(romMethod);
+      }
+   catch (const std::bad_alloc &)
+      {
+      // The method will not be refreshed
+      }
+   }
+
+void
+TR_IProfiler::refreshPersistedProfiles(J9VMThread *vmThread)
+   {
+   if (!_persistedMethods || !TR::Options::sharedClassCache())
+      return;
+
+   uint64_t crtTime = _compInfo->getPersistentInfo()->getElapsedTime();
+   if (crtTime < _lastPersistenceRefreshTime + TR::Options::_iprofilerPersistenceRefreshInterval)
+      return;
+   _lastPersistenceRefreshTime = crtTime;
+
+   // Refresh a bounded number of methods each time, continuing where the previous refresh stopped
+   J9ROMMethod *batch[PERSISTENCE_REFRESH_BATCH_SIZE];
+   uint32_t batchSize = 0;
+      {
+      OMR::CriticalSection selectMethods(_persistedMethodsMonitor);
+      size_t numMethods = _persistedMethods->size();
+      for (; batchSize < PERSISTENCE_REFRESH_BATCH_SIZE && batchSize < numMethods; batchSize++)
+         {
+         if (_persistedMethodsCursor >= numMethods)
+            _persistedMethodsCursor = 0;
+         batch[batchSize] = (*_persistedMethods)[_persistedMethodsCursor++];
+         }
+      }
+   if (batchSize == 0)
+      return;
+
+   TR_J9SharedCache *sharedCache = TR_J9VMBase::get(_compInfo->getJITConfig(), vmThread, TR_J9VMBase::AOT_VM)->sharedCache();
+   if (!sharedCache)
+      return;
+
+   uint32_t numRefreshed = 0;
+   for (uint32_t i = 0; i < batchSize; i++)
+      numRefreshed += refreshPersistedProfile(vmThread, sharedCache, batch[i]);
+   _numPersistedEntriesRefreshed += numRefreshed;
+
+   if (numRefreshed > 0 && TR::Options::getCmdLineOptions()->getOption(TR_VerboseInterpreterProfiling))
+      {
+      TR_VerboseLog::writeLineLocked(TR_Vlog_IPROFILER, "t=%6u IProfiler refreshed %u call-site profiles of %u methods in the shared class cache",
+         (uint32_t)crtTime, numRefreshed, batchSize);
+      }
+   }
+
+// Returns the number of call-site profiles of the given method that were updated in the shared class cache
+uint32_t
+TR_IProfiler::refreshPersistedProfile(J9VMThread *vmThread, TR_J9SharedCache *sharedCache, J9ROMMethod *romMethod)
+   {
+   J9SharedClassConfig *scConfig = _compInfo->getJITConfig()->javaVM->sharedClassConfig;
+   unsigned char storeBuffer[1000];
+   J9SharedDataDescriptor descriptor;
+   descriptor.address = storeBuffer;
+   descriptor.length = sizeof(storeBuffer);
+   descriptor.type = J9SHR_ATTACHED_DATA_TYPE_JITPROFILE;
+   descriptor.flags = J9SHR_ATTACHED_DATA_NO_FLAGS;
+   IDATA dataIsCorrupt;
+   TR_IPBCDataStorageHeader *root = (TR_IPBCDataStorageHeader *)scConfig->findAttachedData(vmThread, romMethod, &descriptor, &dataIsCorrupt);
+   if (root != (TR_IPBCDataStorageHeader *)descriptor.address)  // a stronger check, as found can be error value
+      return 0;
+   return refreshPersistedEntries(vmThread, sharedCache, romMethod, storeBuffer, root);
+   }
+
+// Walks the BST stored for a method (see createBalancedBST) and overwrites, in place, every
+// call-graph node for which the in-memory entry has more samples. The sample count of a
+// node acts as its version: a refresh never replaces a profile with a less sampled one, and
+// rewriting a node does not change its size, so the layout of the record is preserved.
+uint32_t
+TR_IProfiler::refreshPersistedEntries(J9VMThread *vmThread, TR_J9SharedCache *sharedCache, J9ROMMethod *romMethod,
+                                      uint8_t *record, TR_IPBCDataStorageHeader *node)
+   {
+   uint32_t numRefreshed = 0;
+   if (node->ID == TR_IPBCD_CALL_GRAPH)
+      {
+      uintptr_t pc = (uintptr_t)sharedCache->ptrToROMClassesSectionFromOffsetInSharedCache(node->pc);
+      TR_IPBytecodeHashTableEntry *entry = searchForSample(pc);
+      TR_IPBCDataCallGraph *cgEntry = entry ? entry->asIPBCDataCallGraph() : NULL;
+      if (cgEntry && !cgEntry->isInvalid() && !invalidateEntryIfInconsistent(cgEntry))
+         {
+         TR_IPBCDataCallGraphStorage *store = (TR_IPBCDataCallGraphStorage *)node;
+         int32_t storedCount = store->_csInfo._residueWeight;
+         for (int32_t i = 0; i < NUM_CS_SLOTS; i++)
+            storedCount += store->_csInfo._weight[i];
+
+         TR::PersistentInfo *info = _compInfo->getPersistentInfo();
+         // Overflow weights are never persisted, so they must not make the stored record look stale
+         if (cgEntry->getPersistedSumCount() > storedCount &&
+             cgEntry->canBePersisted(sharedCache, info) == IPBC_ENTRY_CAN_PERSIST)
+            {
+            uint32_t left = node->left;
+            uint32_t right = node->right;
+            cgEntry->createPersistentCopy(sharedCache, node, info);
+            cgEntry->releaseEntry();
+            node->left = left;
+            node->right = right;
+
+            J9SharedClassConfig *scConfig = _compInfo->getJITConfig()->javaVM->sharedClassConfig;
+            J9SharedDataDescriptor descriptor;
+            descriptor.address = (U_8 *)node;
+            descriptor.length = sizeof(TR_IPBCDataCallGraphStorage);
+            descriptor.type = J9SHR_ATTACHED_DATA_TYPE_JITPROFILE;
+            descriptor.flags = J9SHR_ATTACHED_DATA_NO_FLAGS;
+            if (scConfig->updateAttachedData(vmThread, romMethod, (I_32)((uint8_t *)node - record), &descriptor) == 0)
+               numRefreshed++;
+            }
+         }
+      }
+
+   if (node->left)
+      numRefreshed += refreshPersistedEntries(vmThread, sharedCache, romMethod, record, (TR_IPBCDataStorageHeader *)((uint8_t *)node + node->left));
+   if (node->right)
+      numRefreshed += refreshPersistedEntries(vmThread, sharedCache, romMethod, record, (TR_IPBCDataStorageHeader *)((uint8_t *)node + node->right));
+   return numRefreshed;
+   }
+
 uint32_t
 TR_IProfiler::getProfilerMemoryFootprint()
    {
@@ -572,8 +709,11 @@ TR_IProfiler::TR_IProfiler(J9JITConfig *jitConfig)
      _valueProfileMethod(NULL), _lightHashTableMonitor(0), _allowedToGiveInlinedInformation(true),
      _globalAllocationCount (0), _maxCallFrequency(0), _iprofilerThread(0), _iprofilerOSThread(NULL),
      _workingBufferTail(NULL), _numOutstandingBuffers(0), _numRequests(1), _numRequestsSkipped(0),
+     _numRequestsSkippedOutstandingBuffers(0), _numRequestsSkippedLoadFactor(0), _numRequestsProcessedByAppThread(0),
      _numRequestsHandedToIProfilerThread(0), _iprofilerThreadExitFlag(0), _iprofilerMonitor(NULL),
-     _crtProfilingBuffer(NULL), _iprofilerThreadAttachAttempted(false), _iprofilerNumRecords(0)
+     _crtProfilingBuffer(NULL), _iprofilerThreadAttachAttempted(false), _iprofilerNumRecords(0), _iprofilerNumEntryLookups(0),
+     _persistedMethodsMonitor(NULL), _persistedMethodsSet(NULL), _persistedMethods(NULL), _persistedMethodsCursor(0),
+     _lastPersistenceRefreshTime(0), _numPersistedEntriesRefreshed(0)
    {
    PORT_ACCESS_FROM_JITCONFIG(jitConfig);
 
@@ -592,10 +732,8 @@ TR_IProfiler::TR_IProfiler(J9JITConfig *jitConfig)
    _hashTableMonitor = TR::Monitor::create("JIT-InterpreterProfilingMonitor");
 
    // bytecode hashtable
-   _bcHashTable = (TR_IPBytecodeHashTableEntry**)jitPersistentAlloc(BC_HASH_TABLE_SIZE*sizeof(TR_IPBytecodeHashTableEntry*));
-   if (_bcHashTable != NULL)
-      memset(_bcHashTable, 0, BC_HASH_TABLE_SIZE*sizeof(TR_IPBytecodeHashTableEntry*));
-   else
+   _bcHashTable = TR_IPBytecodeHashTable::allocate(BC_HASH_TABLE_INITIAL_BUCKETS);
+   if (_bcHashTable == NULL)
       _isIProfilingEnabled = false;
 
 #if defined(EXPERIMENTAL_IPROFILER)
@@ -611,6 +749,20 @@ TR_IProfiler::TR_IProfiler(J9JITConfig *jitConfig)
       {
       _isIProfilingEnabled = false;
       }
+
+   if (TR::Options::_iprofilerPersistenceRefreshInterval > 0)
+      {
+      _persistedMethodsMonitor = TR::Monitor::create("JIT-IProfilerPersistedMethodsMonitor");
+      if (_persistedMethodsMonitor)
+         {
+         _persistedMethodsSet = new (PERSISTENT_NEW) PersistentUnorderedSet<J9ROMMethod *>(
+            PersistentUnorderedSet<J9ROMMethod *>::allocator_type(TR::Compiler->persistentAllocator()));
+         _persistedMethods = new (PERSISTENT_NEW) PersistentVector<J9ROMMethod *>(
+            PersistentVector<J9ROMMethod *>::allocator_type(TR::Compiler->persistentAllocator()));
+         if (!_persistedMethodsSet || !_persistedMethods)
+            _persistedMethods = NULL; // refresh is disabled
+         }
+      }
    }
 
 
@@ -644,12 +796,6 @@ TR_IProfiler::isCallGraphProfilingEnabled()
    }
 
 
-inline int32_t
-TR_IProfiler::bcHash(uintptr_t pc)
-   {
-   return (int32_t)((pc & 0x7FFFFFFF) % BC_HASH_TABLE_SIZE);
-   }
-
 inline int32_t
 TR_IProfiler::allocHash(uintptr_t pc)
    {
@@ -1017,20 +1163,211 @@ TR_IProfiler::addSampleData(TR_IPBytecodeHashTableEntry *entry, uintptr_t data,
    return false;
    }
 
+TR_IPBytecodeHashTable *
+TR_IPBytecodeHashTable::allocate(uint32_t initialBuckets)
+   {
+   TR_ASSERT_FATAL((initialBuckets & (initialBuckets - 1)) == 0, "Number of buckets %u must be a power of two", initialBuckets);
+   TR_IPBytecodeHashTable *table = new (PERSISTENT_NEW) TR_IPBytecodeHashTable();
+   if (!table)
+      return NULL;
+   memoryConsumed += (int32_t)sizeof(TR_IPBytecodeHashTable);
+   table->_monitor = TR::Monitor::create("JIT-IProfilerBytecodeHashTableMonitor");
+   table->_array = table->allocateBucketArray(initialBuckets);
+   if (!table->_monitor || !table->_array)
+      return NULL;
+   return table;
+   }
+
+TR_IPBytecodeHashTable::BucketArray *
+TR_IPBytecodeHashTable::allocateBucketArray(uint32_t numBuckets)
+   {
+   // Buckets must start on a cache line boundary so that each bucket fills exactly one line
+   size_t size = sizeof(BucketArray) + CACHE_LINE_SIZE + (size_t)numBuckets * sizeof(Bucket);
+   void *mem = jitPersistentAlloc(size);
+   if (!mem)
+      return NULL;
+   memoryConsumed += (int32_t)size;
+   memset(mem, 0, size);
+
+   BucketArray *array = (BucketArray *)mem;
+   uintptr_t buckets = (uintptr_t)mem + sizeof(BucketArray);
+   array->_buckets = (Bucket *)((buckets + CACHE_LINE_SIZE - 1) & ~(uintptr_t)(CACHE_LINE_SIZE - 1));
+   array->_mask = numBuckets - 1;
+   array->_previous = NULL;
+   return array;
+   }
+
+void *
+TR_IPBytecodeHashTable::allocateFromArena(size_t size)
+   {
+   // Entries contain 64-bit fields, so keep them 8 byte aligned
+   size = (size + 7) & ~(size_t)7;
+   if (_arenaCursor + size > _arenaEnd)
+      {
+      uint8_t *segment = (uint8_t *)jitPersistentAlloc(ARENA_SEGMENT_SIZE + 8);
+      if (!segment)
+         return NULL;
+      memoryConsumed += (int32_t)(ARENA_SEGMENT_SIZE + 8);
+      _arenaCursor = (uint8_t *)(((uintptr_t)segment + 7) & ~(uintptr_t)7);
+      _arenaEnd = _arenaCursor + ARENA_SEGMENT_SIZE;
+      }
+   void *mem = _arenaCursor;
+   _arenaCursor += size;
+   return mem;
+   }
+
 TR_IPBytecodeHashTableEntry *
-TR_IProfiler::searchForSample(uintptr_t pc, int32_t bucket)
+TR_IPBytecodeHashTable::find(const BucketArray *array, uintptr_t pc)
    {
-   TR_IPBytecodeHashTableEntry *entry;
+   uint64_t h = hash(pc);
+   uint32_t tag = (uint32_t)h;
+   uint32_t mask = array->_mask;
+   uint32_t index = (uint32_t)(h >> 32) & mask;
+   for (uint32_t probe = 0; probe <= mask; probe++)
+      {
+      const Bucket *bucket = array->_buckets + ((index + probe) & mask);
+      for (uint32_t slot = 0; slot < SLOTS_PER_BUCKET; slot++)
+         {
+         TR_IPBytecodeHashTableEntry *entry = bucket->_entries[slot];
+         // Slots are filled in order and never cleared, so an empty slot ends the search
+         if (!entry)
+            return NULL;
+         // Without a read barrier a racing reader may see a stale tag and miss
+         // an entry that was just published; findOrCreate rechecks under the monitor
+         if (bucket->_tags[slot] == tag && entry->getPC() == pc)
+            return entry;
+         }
+      }
+   return NULL;
+   }
 
-   for (entry = _bcHashTable[bucket]; entry; entry = entry->getNext())
+bool
+TR_IPBytecodeHashTable::insert(BucketArray *array, TR_IPBytecodeHashTableEntry *entry)
+   {
+   uint64_t h = hash(entry->getPC());
+   uint32_t mask = array->_mask;
+   uint32_t index = (uint32_t)(h >> 32) & mask;
+   for (uint32_t probe = 0; probe <= mask; probe++)
       {
-      if (pc == entry->getPC())
-         return entry;
+      Bucket *bucket = array->_buckets + ((index + probe) & mask);
+      for (uint32_t slot = 0; slot < SLOTS_PER_BUCKET; slot++)
+         {
+         if (!bucket->_entries[slot])
+            {
+            bucket->_tags[slot] = (uint32_t)h;
+            // The tag and the entry contents must be visible before the entry is
+            FLUSH_MEMORY(TR::Compiler->target.isSMP());
+            bucket->_entries[slot] = entry;
+            return true;
+            }
+         }
       }
+   return false; // table is full
+   }
+
+bool
+TR_IPBytecodeHashTable::grow()
+   {
+   BucketArray *oldArray = _array;
+   BucketArray *newArray = allocateBucketArray((oldArray->_mask + 1) * 2);
+   if (!newArray)
+      return false;
+
+   Iterator it(this);
+   for (TR_IPBytecodeHashTableEntry *entry = it.next(); entry; entry = it.next())
+      insert(newArray, entry);
+
+   // Readers may still be scanning the old array, so it is never freed
+   newArray->_previous = oldArray;
+   FLUSH_MEMORY(TR::Compiler->target.isSMP());
+   _array = newArray;
+   return true;
+   }
+
+TR_IPBytecodeHashTableEntry *
+TR_IPBytecodeHashTable::find(uintptr_t pc) const
+   {
+   return find(_array, pc);
+   }
 
+TR_IPBytecodeHashTableEntry *
+TR_IPBytecodeHashTable::findOrCreate(uintptr_t pc, EntryType type)
+   {
+   TR_IPBytecodeHashTableEntry *entry = find(_array, pc);
+   if (entry)
+      return entry;
+
+   OMR::CriticalSection insertEntry(_monitor);
+
+   // Another thread may have added the entry while we waited for the monitor
+   entry = find(_array, pc);
+   if (entry)
+      return entry;
+
+   // Keep the load factor under 75%; if growing fails keep filling the current array
+   uint32_t capacity = (_array->_mask + 1) * SLOTS_PER_BUCKET;
+   if ((_numEntries + 1) > capacity / 4 * 3)
+      {
+      if (!grow() && _numEntries >= capacity)
+         return NULL;
+      }
+
+   void *mem = NULL;
+   switch (type)
+      {
+      case FourBytesEntry:
+         mem = allocateFromArena(sizeof(TR_IPBCDataFourBytes));
+         if (mem)
+            entry = new (mem) TR_IPBCDataFourBytes(pc);
+         break;
+      case EightWordsEntry:
+         mem = allocateFromArena(sizeof(TR_IPBCDataEightWords));
+         if (mem)
+            entry = new (mem) TR_IPBCDataEightWords(pc);
+         break;
+      case CallGraphEntry:
+         mem = allocateFromArena(sizeof(TR_IPBCDataCallGraph));
+         if (mem)
+            entry = new (mem) TR_IPBCDataCallGraph(pc);
+         break;
+      }
+
+   if (!entry || !insert(_array, entry))
+      return NULL;
+
+   _numEntries++;
+   return entry;
+   }
+
+TR_IPBytecodeHashTable::Iterator::Iterator(const TR_IPBytecodeHashTable *table)
+   : _array(table->_array), _bucket(0), _slot(0)
+   {
+   }
+
+TR_IPBytecodeHashTableEntry *
+TR_IPBytecodeHashTable::Iterator::next()
+   {
+   while (_bucket <= _array->_mask)
+      {
+      const Bucket *bucket = _array->_buckets + _bucket;
+      while (_slot < SLOTS_PER_BUCKET)
+         {
+         TR_IPBytecodeHashTableEntry *entry = bucket->_entries[_slot++];
+         if (entry)
+            return entry;
+         }
+      _bucket++;
+      _slot = 0;
+      }
    return NULL;
    }
 
+TR_IPBytecodeHashTableEntry *
+TR_IProfiler::searchForSample(uintptr_t pc)
+   {
+   return _bcHashTable->find(pc);
+   }
+
 TR_IPBCDataAllocation *
 TR_IProfiler::searchForAllocSample(uintptr_t pc, int32_t bucket)
    {
@@ -1050,11 +1387,9 @@ TR_IProfiler::searchForAllocSample(uintptr_t pc, int32_t bucket)
 
 
 TR_IPBytecodeHashTableEntry *
-TR_IProfiler::findOrCreateEntry(int32_t bucket, uintptr_t pc, bool addIt)
+TR_IProfiler::findOrCreateEntry(uintptr_t pc, bool addIt)
    {
-   TR_IPBytecodeHashTableEntry *entry = NULL;
-
-   entry = searchForSample (pc, bucket);
+   TR_IPBytecodeHashTableEntry *entry = searchForSample(pc);
    // if we are just searching and we didn't find profile data for the
    // method just go back
    if (!addIt)
@@ -1065,24 +1400,15 @@ TR_IProfiler::findOrCreateEntry(int32_t bucket, uintptr_t pc, bool addIt)
 
    // Create a new hash table entry
    U_8 byteCode = *(U_8*) pc;
+   TR_IPBytecodeHashTable::EntryType type;
    if (isCompact(byteCode))
-      entry = new TR_IPBCDataFourBytes(pc);
+      type = TR_IPBytecodeHashTable::FourBytesEntry;
+   else if (isSwitch(byteCode))
+      type = TR_IPBytecodeHashTable::EightWordsEntry;
    else
-      {
-      if (isSwitch(byteCode))
-         entry = new TR_IPBCDataEightWords(pc);
-      else
-         entry = new TR_IPBCDataCallGraph(pc);
-      }
-
-   if (!entry)
-      return NULL;
+      type = TR_IPBytecodeHashTable::CallGraphEntry;
 
-   entry->setNext(_bcHashTable[bucket]);
-   FLUSH_MEMORY(TR::Compiler->target.isSMP());
-   _bcHashTable[bucket] = entry;
-
-   return entry;
+   return _bcHashTable->findOrCreate(pc, type);
    }
 
 TR_IPBCDataAllocation *
@@ -1312,7 +1638,7 @@ TR_IProfiler::persistentProfilingSample(TR_OpaqueMethodBlock *method, uint32_t b
          if (store)
             {
             // Create a new IProfiler hashtable entry and copy the data from the SCC
-            TR_IPBytecodeHashTableEntry *newEntry = findOrCreateEntry(bcHash(pc), pc, true);
+            TR_IPBytecodeHashTableEntry *newEntry = findOrCreateEntry(pc, true);
             newEntry->loadFromPersistentCopy(store, comp);
             return newEntry;
             }
@@ -1395,7 +1721,7 @@ TR_IProfiler::profilingSample (TR_OpaqueMethodBlock *method, uint32_t byteCodeIn
 
       U_8 bytecode =  *(U_8 *)pc;
       // Find the pc in the IProfiler/bytecode hashtable
-      TR_IPBytecodeHashTableEntry * currentEntry = findOrCreateEntry(bcHash(pc), pc, false);
+      TR_IPBytecodeHashTableEntry * currentEntry = findOrCreateEntry(pc, false);
       TR_IPBytecodeHashTableEntry * persistentEntry = NULL;
       TR_IPBytecodeHashTableEntry * entry = currentEntry;
       TR_IPBCDataStorageHeader *persistentEntryStore = NULL;
@@ -1531,7 +1857,7 @@ TR_IProfiler::profilingSample (TR_OpaqueMethodBlock *method, uint32_t byteCodeIn
             if (persistentEntry && (persistentEntry->getData()))
                {
                _STATS_IPEntryChoosePersistent++;
-               currentEntry = findOrCreateEntry(bcHash(pc), pc, true);
+               currentEntry = findOrCreateEntry(pc, true);
                currentEntry->copyFromEntry(persistentEntry, comp);
                // Remember that we already looked into the SCC for this PC
                currentEntry->setPersistentEntryRead();
@@ -1618,7 +1944,7 @@ TR_IPBCDataEightWords::getSumSwitchCount()
 TR_IPBytecodeHashTableEntry *
 TR_IProfiler::profilingSample (uintptr_t pc, uintptr_t data, bool addIt, bool isRIData, uint32_t freq)
    {
-   TR_IPBytecodeHashTableEntry *entry = findOrCreateEntry(bcHash(pc), pc, addIt);
+   TR_IPBytecodeHashTableEntry *entry = findOrCreateEntry(pc, addIt);
 
    if (entry && addIt)
       {
@@ -2423,6 +2749,18 @@ TR_IProfiler::createIProfilingValueInfo (TR_ByteCodeInfo &bcInfo, TR::Compilatio
                   list->incrementOrCreate(address, &addrOfTotalFrequency, i, weight, &comp->trMemory()->heapMemoryRegion());
                   }
                }
+            // megamorphic call sites may have more receivers for the inliner to guard on
+            CallSiteProfileOverflow *overflow = cgData->getCGOverflowData();
+            for (int32_t i = 0; overflow && i < NUM_CS_OVERFLOW_SLOTS; i++)
+               {
+               data = overflow->_clazz[i];
+               if (data)
+                  {
+                  weight = overflow->_weight[i];
+                  ProfileAddressType address = static_cast<ProfileAddressType>(data);
+                  list->incrementOrCreate(address, &addrOfTotalFrequency, NUM_CS_SLOTS + i, weight, &comp->trMemory()->heapMemoryRegion());
+                  }
+               }
             // add residual to last total frequency
             *addrOfTotalFrequency = (*addrOfTotalFrequency) + csInfo->_residueWeight;
             }
@@ -2561,8 +2899,15 @@ TR_IProfiler::outputStats()
       fprintf(stderr, "IProfiler: Number of buffers to be processed           =%" OMR_PRIu64 "\n", _numRequests);
       fprintf(stderr, "IProfiler: Number of buffers discarded                 =%" OMR_PRIu64 "\n", _numRequestsSkipped);
       fprintf(stderr, "IProfiler: Number of buffers handed to iprofiler thread=%" OMR_PRIu64 "\n", _numRequestsHandedToIProfilerThread);
+      fprintf(stderr, "IProfiler: Number of buffers processed by app threads  =%" OMR_PRIu64 "\n", _numRequestsProcessedByAppThread);
+      fprintf(stderr, "IProfiler: Buffer drop rate=%.2f%% (too many outstanding buffers=%" OMR_PRIu64 ", load factor too high=%" OMR_PRIu64 ")\n",
+              _numRequests ? 100.0 * _numRequestsSkipped / _numRequests : 0.0,
+              _numRequestsSkippedOutstandingBuffers, _numRequestsSkippedLoadFactor);
       }
    fprintf(stderr, "IProfiler: Number of records processed=%" OMR_PRIu64 "\n", _iprofilerNumRecords);
+   fprintf(stderr, "IProfiler: Number of hashtable lookups for processed records=%" OMR_PRIu64 "\n", _iprofilerNumEntryLookups);
+   if (_persistedMethods)
+      fprintf(stderr, "IProfiler: Number of call-site profiles refreshed in the SCC=%" OMR_PRIu64 "\n", _numPersistedEntriesRefreshed);
    fprintf(stderr, "IProfiler: Number of hashtable entries=%u\n", countEntries());
    checkMethodHashTable();
    }
@@ -2750,6 +3095,9 @@ TR_IPBCDataCallGraph::setData(uintptr_t v, uint32_t freq)
          maxWeight = _csInfo._weight[i];
       }
 
+   if (!found)
+      found = addToOverflow(v, freq, returnCount);
+
    if (!found)
       {
       // Must update the `residue` bucket
@@ -2760,12 +3108,52 @@ TR_IPBCDataCallGraph::setData(uintptr_t v, uint32_t freq)
       _csInfo._residueWeight = newResidueWeight;
       returnCount = newResidueWeight;
 
+      CallSiteProfileOverflow *overflow = _overflow;
+      if (!overflow && _csInfo._residueWeight >= CS_OVERFLOW_RESIDUE_THRESHOLD)
+         {
+         // The call site is megamorphic; track more receivers from now on
+         overflow = new (PERSISTENT_NEW) CallSiteProfileOverflow();
+         if (overflow)
+            {
+            memoryConsumed += (int32_t)sizeof(CallSiteProfileOverflow);
+            overflow->_clazz[0] = v;
+            overflow->_weight[0] = freq;
+            FLUSH_MEMORY(TR::Compiler->target.isSMP());
+            if (VM_AtomicSupport::lockCompareExchange((uintptr_t *)&_overflow, (uintptr_t)NULL, (uintptr_t)overflow) == (uintptr_t)NULL)
+               {
+               returnCount = freq;
+               return returnCount;
+               }
+            // Another thread attached an overflow first
+            memoryConsumed -= (int32_t)sizeof(CallSiteProfileOverflow);
+            jitPersistentFree(overflow);
+            overflow = _overflow;
+            }
+         }
+
+      if (overflow)
+         {
+         for (int32_t i = 0; i < NUM_CS_OVERFLOW_SLOTS; i++)
+            {
+            if (maxWeight < overflow->_weight[i])
+               maxWeight = overflow->_weight[i];
+            }
+         }
+
       if (_csInfo._residueWeight > maxWeight)
          {
          if (lockEntry())
             {
             // Reset the entries in reverse order
             // Want to avoid the situation where one entry has the class reset, but a subsequent entry does not
+            if (overflow)
+               {
+               for (int32_t i = NUM_CS_OVERFLOW_SLOTS - 1; i >= 0; i--)
+                  {
+                  overflow->_clazz[i] = 0;
+                  overflow->_weight[i] = 0;
+                  }
+               }
             for (int32_t i = NUM_CS_SLOTS - 1; i > 0; i--)
                {
                _csInfo.setClazz(i, 0);
@@ -2783,6 +3171,40 @@ TR_IPBCDataCallGraph::setData(uintptr_t v, uint32_t freq)
    return returnCount;
    }
 
+/**
+ * @brief Records a receiver in the overflow slots, if this call site has them
+ * @return true if the receiver was recorded, false if it belongs to the residue
+ */
+bool
+TR_IPBCDataCallGraph::addToOverflow(uintptr_t v, uint32_t freq, int32_t &returnCount)
+   {
+   CallSiteProfileOverflow *overflow = _overflow;
+   if (!overflow)
+      return false;
+
+   for (int32_t i = 0; i < NUM_CS_OVERFLOW_SLOTS; i++)
+      {
+      if (overflow->_clazz[i] == v)
+         {
+         uint16_t oldWeight = overflow->_weight[i];
+         uint16_t newWeight = oldWeight + freq;
+         if (newWeight < oldWeight)
+            newWeight = 0xFFFF;
+         overflow->_weight[i] = newWeight;
+         returnCount = newWeight;
+         return true;
+         }
+      else if (overflow->_clazz[i] == 0)
+         {
+         overflow->_clazz[i] = v;
+         overflow->_weight[i] = freq;
+         returnCount = freq;
+         return true;
+         }
+      }
+   return false;
+   }
+
 int32_t
 TR_IPBCDataCallGraph::getSumCount(TR::Compilation *comp)
    {
@@ -2790,6 +3212,22 @@ TR_IPBCDataCallGraph::getSumCount(TR::Compilation *comp)
    for (int32_t i = 0; i < NUM_CS_SLOTS; i++)
       sumWeight += _csInfo._weight[i];
 
+   CallSiteProfileOverflow *overflow = _overflow;
+   if (overflow)
+      {
+      for (int32_t i = 0; i < NUM_CS_OVERFLOW_SLOTS; i++)
+         sumWeight += overflow->_weight[i];
+      }
+
+   return sumWeight + _csInfo._residueWeight;
+   }
+
+int32_t
+TR_IPBCDataCallGraph::getPersistedSumCount()
+   {
+   int32_t sumWeight = 0;
+   for (int32_t i = 0; i < NUM_CS_SLOTS; i++)
+      sumWeight += _csInfo._weight[i];
    return sumWeight + _csInfo._residueWeight;
    }
 
@@ -2809,6 +3247,12 @@ TR_IPBCDataCallGraph::getSumCount(TR::Compilation *comp, bool)
          }
       sumWeight += _csInfo._weight[i];
       }
+   CallSiteProfileOverflow *overflow = _overflow;
+   if (overflow)
+      {
+      for (int32_t i = 0; i < NUM_CS_OVERFLOW_SLOTS; i++)
+         sumWeight += overflow->_weight[i];
+      }
    sumWeight += _csInfo._residueWeight;
    if(debug)
       {
@@ -2824,6 +3268,21 @@ TR_IPBCDataCallGraph::getData(TR::Compilation *comp)
    int32_t sumWeight;
    int32_t maxWeight;
    uintptr_t data = _csInfo.getDominantClass(sumWeight, maxWeight);
+   CallSiteProfileOverflow *overflow = _overflow;
+   if (overflow)
+      {
+      for (int32_t i = 0; i < NUM_CS_OVERFLOW_SLOTS; i++)
+         {
+         if (!overflow->_clazz[i])
+            continue;
+         if (overflow->_weight[i] > maxWeight)
+            {
+            maxWeight = overflow->_weight[i];
+            data = overflow->_clazz[i];
+            }
+         sumWeight += overflow->_weight[i];
+         }
+      }
 
    static bool traceIProfiling = ((debug("traceIProfiling") != NULL));
    if (traceIProfiling && comp)
@@ -2872,6 +3331,15 @@ TR_IPBCDataCallGraph::getEdgeWeight(TR_OpaqueClassBlock *clazz, TR::Compilation
          return _csInfo._weight[i];
          }
       }
+   CallSiteProfileOverflow *overflow = _overflow;
+   if (overflow)
+      {
+      for (int32_t i = 0; i < NUM_CS_OVERFLOW_SLOTS; i++)
+         {
+         if (overflow->_clazz[i] == (uintptr_t)clazz)
+            return overflow->_weight[i];
+         }
+      }
    return 0;
    }
 
@@ -2888,6 +3356,16 @@ TR_IPBCDataCallGraph::printWeights(TR::Compilation *comp)
 
       fprintf(stderr, "%#" OMR_PRIxPTR " %s %d\n", _csInfo.getClazz(i), s, _csInfo._weight[i]);
       }
+   CallSiteProfileOverflow *overflow = _overflow;
+   for (int32_t i = 0; overflow && i < NUM_CS_OVERFLOW_SLOTS; i++)
+      {
+      if (!overflow->_clazz[i])
+         continue;
+      int32_t len;
+      const char * s = comp->fej9()->getClassNameChars((TR_OpaqueClassBlock*)overflow->_clazz[i], len);
+
+      fprintf(stderr, "%#" OMR_PRIxPTR " %s %d\n", overflow->_clazz[i], s, overflow->_weight[i]);
+      }
    fprintf(stderr, "%d\n", _csInfo._residueWeight);
    }
 
@@ -2899,7 +3377,19 @@ TR_IPBCDataCallGraph::updateEdgeWeight(TR_OpaqueClassBlock *clazz, int32_t weigh
       if (_csInfo.getClazz(i) == (uintptr_t)clazz)
          {
          _csInfo._weight[i] = weight;
-         break;
+         return;
+         }
+      }
+   CallSiteProfileOverflow *overflow = _overflow;
+   if (overflow)
+      {
+      for (int32_t i = 0; i < NUM_CS_OVERFLOW_SLOTS; i++)
+         {
+         if (overflow->_clazz[i] == (uintptr_t)clazz)
+            {
+            overflow->_weight[i] = weight;
+            return;
+            }
          }
       }
    }
@@ -3378,15 +3868,13 @@ uint32_t
 TR_IProfiler::releaseAllEntries()
    {
    uint32_t count = 0;
-   for (int32_t bucket = 0; bucket < BC_HASH_TABLE_SIZE; bucket++)
+   TR_IPBytecodeHashTable::Iterator it(_bcHashTable);
+   for (TR_IPBytecodeHashTableEntry *entry = it.next(); entry; entry = it.next())
       {
-      for (TR_IPBytecodeHashTableEntry *entry = _bcHashTable[bucket]; entry; entry = entry->getNext())
+      if (entry->asIPBCDataCallGraph() && entry->asIPBCDataCallGraph()->isLocked())
          {
-         if (entry->asIPBCDataCallGraph() && entry->asIPBCDataCallGraph()->isLocked())
-            {
-            count++;
-            entry->asIPBCDataCallGraph()->releaseEntry();
-            }
+         count++;
+         entry->asIPBCDataCallGraph()->releaseEntry();
          }
       }
    return count;
@@ -3395,11 +3883,7 @@ TR_IProfiler::releaseAllEntries()
 uint32_t
 TR_IProfiler::countEntries()
    {
-   uint32_t count = 0;
-   for (int32_t bucket = 0; bucket < BC_HASH_TABLE_SIZE; bucket++)
-      for (TR_IPBytecodeHashTableEntry *entry = _bcHashTable[bucket]; entry; entry = entry->getNext())
-         count++;
-   return count;
+   return _bcHashTable->getNumEntries();
    }
 
 
@@ -3407,36 +3891,28 @@ TR_IProfiler::countEntries()
 //
 void TR_IProfiler::setupEntriesInHashTable(TR_IProfiler *ip)
    {
-   for (int32_t bucket = 0; bucket < BC_HASH_TABLE_SIZE; bucket++)
+   TR_IPBytecodeHashTable::Iterator it(_bcHashTable);
+   for (TR_IPBytecodeHashTableEntry *entry = it.next(); entry; entry = it.next())
       {
-      TR_IPBytecodeHashTableEntry *entry = _bcHashTable[bucket], *prevEntry = NULL;
+      uintptr_t pc = entry->getPC();
 
-      while (entry)
+      if (pc == 0 ||
+            pc == 0xffffffff)
          {
-         uintptr_t pc = entry->getPC();
-
-         if (pc == 0 ||
-               pc == 0xffffffff)
-            {
-            printf("invalid pc for entry %p %#" OMR_PRIxPTR "\n", entry, pc);
-            fflush(stdout);
-            prevEntry = entry;
-            entry = entry->getNext();
-            continue;
-            }
+         printf("invalid pc for entry %p %#" OMR_PRIxPTR "\n", entry, pc);
+         fflush(stdout);
+         continue;
+         }
 
 
-         TR_IPBytecodeHashTableEntry *newEntry = ip->findOrCreateEntry(bucket, pc, true);
-         // check for entries corresponding to
-         // unloaded methods, findOrCreateEntry will
-         // return NULL above. its ok to ignore these entries
-         // as they are invalid anyway
-         //
-         if (newEntry)
-            ip->copyDataFromEntry(entry, newEntry, NULL);
-         prevEntry = entry;
-         entry = entry->getNext();
-         }
+      TR_IPBytecodeHashTableEntry *newEntry = ip->findOrCreateEntry(pc, true);
+      // check for entries corresponding to
+      // unloaded methods, findOrCreateEntry will
+      // return NULL above. its ok to ignore these entries
+      // as they are invalid anyway
+      //
+      if (newEntry)
+         ip->copyDataFromEntry(entry, newEntry, NULL);
       }
    printf("Finished adding entries from core to new iprofiler\n");
    }
@@ -3876,7 +4352,8 @@ TR_IProfiler::postIprofilingBufferToWorkingQueue(J9VMThread * vmThread, const U_
 // Method executed by the java thread when jitHookBytecodeProfiling() is called
 bool TR_IProfiler::processProfilingBuffer(J9VMThread *vmThread, const U_8* dataStart, UDATA size)
    {
-   if (_numOutstandingBuffers >= TR::Options::_iprofilerNumOutstandingBuffers ||
+   bool tooManyOutstandingBuffers = _numOutstandingBuffers >= TR::Options::_iprofilerNumOutstandingBuffers;
+   if (tooManyOutstandingBuffers ||
        _compInfo->getPersistentInfo()->getLoadFactor() >= 1) // More active threads than CPUs
       {
       if (100*_numRequestsSkipped >= (uint64_t)TR::Options::_iprofilerBufferMaxPercentageToDiscard * _numRequests)
@@ -3884,11 +4361,16 @@ bool TR_IProfiler::processProfilingBuffer(J9VMThread *vmThread, const U_8* dataS
          // too many skipped requests; let the java thread handle this one
          //records = parseBuffer(vmThread, cursor, size, iProfiler);
          //setProfilingBufferCursor(vmThread, (U_8*)cursor);
+         _numRequestsProcessedByAppThread++;
          return false; // delegate the processing to the java thread
          }
       else // skip this request altogether
          {
          _numRequestsSkipped++;
+         if (tooManyOutstandingBuffers)
+            _numRequestsSkippedOutstandingBuffers++;
+         else
+            _numRequestsSkippedLoadFactor++;
          setProfilingBufferCursor(vmThread, (U_8*)dataStart);
          }
       }
@@ -3897,6 +4379,7 @@ bool TR_IProfiler::processProfilingBuffer(J9VMThread *vmThread, const U_8* dataS
       if (!postIprofilingBufferToWorkingQueue(vmThread, dataStart, size))
          {
          // If posting fails, we should let the app thread process the buffer
+         _numRequestsProcessedByAppThread++;
          return false;
          //_numRequestsSkipped++;
          //setProfilingBufferCursor(vmThread, (U_8*)dataStart);
@@ -3938,6 +4421,7 @@ void TR_IProfiler::processWorkingQueue()
             parseBuffer(_iprofilerThread, _crtProfilingBuffer->getBuffer(), _crtProfilingBuffer->getSize());
          //fprintf(stderr, "IProfiler thread finished processing\n");
             }
+         refreshPersistedProfiles(_iprofilerThread);
          releaseVMAccess(_iprofilerThread);
          }
       else // Special
@@ -4043,6 +4527,10 @@ UDATA TR_IProfiler::parseBuffer(J9VMThread * vmThread, const U_8* dataStart, UDA
    int32_t skipCount = skipCountMain;
    bool profileFlag = true;
 
+   // Samples are applied to the hash table in batches, see applySampleBatch
+   BufferedSample sampleBatch[SAMPLE_BATCH_SIZE];
+   uint32_t numBatchedSamples = 0;
+
    while (cursor < dataStart + size)
       {
       const U_8* cursorCopy = cursor;
@@ -4228,11 +4716,22 @@ UDATA TR_IProfiler::parseBuffer(J9VMThread * vmThread, const U_8* dataStart, UDA
 
       if (addSample && !verboseReparse)
          {
-         profilingSample ((uintptr_t)pc, (uintptr_t)data, true);
+         BufferedSample &sample = sampleBatch[numBatchedSamples];
+         sample._pc = (uintptr_t)pc;
+         sample._data = (uintptr_t)data;
+         sample._seq = numBatchedSamples;
+         if (++numBatchedSamples == SAMPLE_BATCH_SIZE)
+            {
+            applySampleBatch(sampleBatch, numBatchedSamples);
+            numBatchedSamples = 0;
+            }
          records++;
          }
       }
 
+   if (numBatchedSamples > 0)
+      applySampleBatch(sampleBatch, numBatchedSamples);
+
    if (cursor != dataStart + size)
       {
       //j9tty_printf(PORTLIB, "Error! Parser overran buffer.\n");
@@ -4245,6 +4744,37 @@ UDATA TR_IProfiler::parseBuffer(J9VMThread * vmThread, const U_8* dataStart, UDA
    }
 
 
+static bool
+compareBufferedSamples(const TR_IProfiler::BufferedSample &a, const TR_IProfiler::BufferedSample &b)
+   {
+   if (a._pc != b._pc)
+      return a._pc < b._pc;
+   return a._seq < b._seq;
+   }
+
+// Sorting the samples by pc groups the samples of each bytecode, which are then
+// applied with a single hash table lookup, and walks the table and the entries
+// in address order rather than in the order the interpreter recorded them
+void
+TR_IProfiler::applySampleBatch(BufferedSample *samples, uint32_t numSamples)
+   {
+   std::sort(samples, samples + numSamples, compareBufferedSamples);
+
+   uint32_t i = 0;
+   while (i < numSamples)
+      {
+      uintptr_t pc = samples[i]._pc;
+      TR_IPBytecodeHashTableEntry *entry = findOrCreateEntry(pc, true);
+      _iprofilerNumEntryLookups++;
+      bool isValid = entry && !invalidateEntryIfInconsistent(entry);
+      for (; i < numSamples && samples[i]._pc == pc; i++)
+         {
+         if (isValid)
+            addSampleData(entry, samples[i]._data, false, 1);
+         }
+      }
+   }
+
 // This method should be called from Jitted code when it has a full buffer. It is called indirectly from
 // _jitProfileParseBuffer, in JitRuntime
 void TR_IProfiler::jitProfileParseBuffer(J9VMThread *currentThread)
@@ -4666,6 +5196,16 @@ void TR_AggregationHT::sortByNameAndPrint(TR_J9VMBase *fe)
                fprintf(stderr, "\t\tW:%4u\tM:%#" OMR_PRIxPTR "\t%.*s\n", cgData->_weight[j], cgData->getClazz(j), len, s);
                }
             }
+         CallSiteProfileOverflow *overflow = ipbcCGData->getCGOverflowData();
+         for (int j = 0; overflow && j < NUM_CS_OVERFLOW_SLOTS; j++)
+            {
+            if (overflow->_clazz[j])
+               {
+               int32_t len;
+               const char * s = fe->getClassNameChars((TR_OpaqueClassBlock*)overflow->_clazz[j], len);
+               fprintf(stderr, "\t\tW:%4u\tM:%#" OMR_PRIxPTR "\t%.*s\n", overflow->_weight[j], overflow->_clazz[j], len, s);
+               }
+            }
          fprintf(stderr, "\t\tW:%4u\n", cgData->_residueWeight);
          }
       }
@@ -4689,7 +5229,7 @@ void TR_AggregationHT::sortByNameAndPrint(TR_J9VMBase *fe)
 void TR_IProfiler::dumpIPBCDataCallGraph(J9VMThread* vmThread)
    {
    fprintf(stderr, "Dumping info ...\n");
-   TR_AggregationHT aggregationHT(BC_HASH_TABLE_SIZE);
+   TR_AggregationHT aggregationHT(AGGREGATION_HASH_TABLE_SIZE);
    if (aggregationHT.getSize() == 0) // OOM
       {
       fprintf(stderr, "Cannot allocate memory. Bailing out.\n");
@@ -4714,54 +5254,51 @@ void TR_IProfiler::dumpIPBCDataCallGraph(J9VMThread* vmThread)
    TR_J9VMBase * fe = TR_J9VMBase::get(javaVM->jitConfig, vmThread);
 
    fprintf(stderr, "Aggregating per method ...\n");
-   for (int32_t bucket = 0; bucket < BC_HASH_TABLE_SIZE; bucket++)
+   TR_IPBytecodeHashTable::Iterator it(_bcHashTable);
+   for (TR_IPBytecodeHashTableEntry *entry = it.next(); entry; entry = it.next())
       {
-      //fprintf(stderr, "Looking at bucket %d\n", bucket);
-      for (TR_IPBytecodeHashTableEntry *entry = _bcHashTable[bucket]; entry; entry = entry->getNext())
+      // Skip invalid entries
+      if (entry->isInvalid() || invalidateEntryIfInconsistent(entry))
+         continue;
+      TR_IPBCDataCallGraph *cgEntry = entry->asIPBCDataCallGraph();
+      if (cgEntry)
          {
-         // Skip invalid entries
-         if (entry->isInvalid() || invalidateEntryIfInconsistent(entry))
-            continue;
-         TR_IPBCDataCallGraph *cgEntry = entry->asIPBCDataCallGraph();
-         if (cgEntry)
+         // Get the pc and find the method this pc belongs to
+         U_8* pc = (U_8*)cgEntry->getPC();
+         //fprintf(stderr, "\tInspecting pc=%p\n", pc);
+         J9ClassLoader* loader;
+         J9ROMClass * romClass = vmFunctions->findROMClassFromPC(vmThread, (UDATA)pc, &loader);
+         if (romClass)
             {
-            // Get the pc and find the method this pc belongs to
-            U_8* pc = (U_8*)cgEntry->getPC();
-            //fprintf(stderr, "\tInspecting pc=%p\n", pc);
-            J9ClassLoader* loader;
-            J9ROMClass * romClass = vmFunctions->findROMClassFromPC(vmThread, (UDATA)pc, &loader);
-            if (romClass)
+            //J9ROMMethod * romMethod = vmFunctions->findROMMethodInROMClass(vmThread, romClass, (UDATA)pc);
+            J9ROMMethod *currentMethod = J9ROMCLASS_ROMMETHODS(romClass);
+            J9ROMMethod *desiredMethod = NULL;
+            //fprintf(stderr, "Scanning %u romMethods...\n", romClass->romMethodCount);
+            for (U_32 i = 0; i < romClass->romMethodCount; i++)
                {
-               //J9ROMMethod * romMethod = vmFunctions->findROMMethodInROMClass(vmThread, romClass, (UDATA)pc);
-               J9ROMMethod *currentMethod = J9ROMCLASS_ROMMETHODS(romClass);
-               J9ROMMethod *desiredMethod = NULL;
-               //fprintf(stderr, "Scanning %u romMethods...\n", romClass->romMethodCount);
-               for (U_32 i = 0; i < romClass->romMethodCount; i++)
+               if (((UDATA)pc >= (UDATA)currentMethod) && ((UDATA)pc < (UDATA)J9_BYTECODE_END_FROM_ROM_METHOD(currentMethod)))
                   {
-                  if (((UDATA)pc >= (UDATA)currentMethod) && ((UDATA)pc < (UDATA)J9_BYTECODE_END_FROM_ROM_METHOD(currentMethod)))
-                     {
-                     // found the method
-                     desiredMethod = currentMethod;
-                     break;
-                     }
-                  currentMethod = nextROMMethod(currentMethod);
+                  // found the method
+                  desiredMethod = currentMethod;
+                  break;
                   }
+               currentMethod = nextROMMethod(currentMethod);
+               }
 
-               if (desiredMethod)
-                  {
-                  // Add the information to the aggregationTable
-                  aggregationHT.add(desiredMethod, romClass, cgEntry);
-                  }
-               else
-                  {
-                  fprintf(stderr, "pc=%p does not belong to romMethod range\n", pc);
-                  }
+            if (desiredMethod)
+               {
+               // Add the information to the aggregationTable
+               aggregationHT.add(desiredMethod, romClass, cgEntry);
                }
             else
                {
-               fprintf(stderr, "pc=%p does not belong to a romMethod\n", pc);
+               fprintf(stderr, "pc=%p does not belong to romMethod range\n", pc);
                }
             }
+         else
+            {
+            fprintf(stderr, "pc=%p does not belong to a romMethod\n", pc);
+            }
          }
       }
    aggregationHT.sortByNameAndPrint(fe);
@@ -66,6 +66,7 @@
 #include "j9cfg.h"
 #include "env/jittypes.h"
 #include "env/CompilerEnv.hpp"
+#include "env/PersistentCollections.hpp"
 #include "il/Node.hpp"
 #include "infra/Link.hpp"
 #include "runtime/ExternalProfiler.hpp"
@@ -144,6 +145,35 @@ private:
    uintptr_t _clazz[NUM_CS_SLOTS]; // store them in either 64 or 32 bits
    };
 
+#define NUM_CS_OVERFLOW_SLOTS 5
+#define CS_OVERFLOW_RESIDUE_THRESHOLD 32
+/**
+ * @class CallSiteProfileOverflow
+ * @brief Additional receiver class slots for megamorphic call sites
+ *
+ * Most call sites see one to three receivers and only use the slots of
+ * CallSiteProfileInfo. Once the residue weight of a call site reaches
+ * CS_OVERFLOW_RESIDUE_THRESHOLD an overflow is attached so that up to
+ * NUM_CS_SLOTS + NUM_CS_OVERFLOW_SLOTS receivers are tracked. Overflow slots
+ * are neither persisted in the shared class cache nor sent to the JITServer.
+ */
+class CallSiteProfileOverflow
+   {
+public:
+   TR_PERSISTENT_ALLOC(TR_Memory::IPBCDataCallGraph)
+   CallSiteProfileOverflow()
+      {
+      for (int i = 0; i < NUM_CS_OVERFLOW_SLOTS; i++)
+         {
+         _clazz[i] = 0;
+         _weight[i] = 0;
+         }
+      }
+
+   uintptr_t _clazz[NUM_CS_OVERFLOW_SLOTS]; // always uncompressed class pointers
+   uint16_t _weight[NUM_CS_OVERFLOW_SLOTS];
+   };
+
 #define TR_IPBCD_FOUR_BYTES  1
 #define TR_IPBCD_EIGHT_WORDS 2
 #define TR_IPBCD_CALL_GRAPH  3
@@ -193,11 +223,9 @@ class TR_IPBytecodeHashTableEntry
 public:
    TR_PERSISTENT_ALLOC(TR_Memory::IProfiler)
    static void* alignedPersistentAlloc(size_t size);
-   TR_IPBytecodeHashTableEntry(uintptr_t pc) : _next(NULL), _pc(pc), _lastSeenClassUnloadID(-1), _entryFlags(0), _persistFlags(IPBC_ENTRY_CAN_PERSIST_FLAG) {}
+   TR_IPBytecodeHashTableEntry(uintptr_t pc) : _pc(pc), _lastSeenClassUnloadID(-1), _entryFlags(0), _persistFlags(IPBC_ENTRY_CAN_PERSIST_FLAG) {}
 
    uintptr_t getPC() const { return _pc; }
-   TR_IPBytecodeHashTableEntry * getNext() const { return _next; }
-   void setNext(TR_IPBytecodeHashTableEntry *n) { _next = n; }
    int32_t getLastSeenClassUnloadID() const { return _lastSeenClassUnloadID; }
    void setLastSeenClassUnloadID(int32_t v) { _lastSeenClassUnloadID = v; }
    virtual uintptr_t getData(TR::Compilation *comp = NULL) = 0;
@@ -237,7 +265,6 @@ public:
    void resetLockedEntry() { _persistFlags &= ~IPBC_ENTRY_PERSIST_LOCK_FLAG; }
 
 protected:
-   TR_IPBytecodeHashTableEntry *_next;
    uintptr_t _pc;
    int32_t    _lastSeenClassUnloadID;
 
@@ -391,7 +418,7 @@ class TR_IPBCDataCallGraph : public TR_IPBytecodeHashTableEntry
    {
 public:
    TR_PERSISTENT_ALLOC(TR_Memory::IPBCDataCallGraph)
-   TR_IPBCDataCallGraph (uintptr_t pc) : TR_IPBytecodeHashTableEntry(pc)
+   TR_IPBCDataCallGraph (uintptr_t pc) : TR_IPBytecodeHashTableEntry(pc), _overflow(NULL)
       {
       _csInfo.initialize();
       }
@@ -409,12 +436,18 @@ public:
 
    virtual uintptr_t getData(TR::Compilation *comp = NULL);
    virtual CallSiteProfileInfo* getCGData() { return &_csInfo; } // overloaded
+   /**
+    * @brief Returns the additional receiver slots of a megamorphic call site or NULL if none were needed
+    */
+   CallSiteProfileOverflow *getCGOverflowData() { return _overflow; }
    virtual int32_t setData(uintptr_t v, uint32_t freq = 1);
    virtual uint32_t* getDataReference() { return NULL; }
    virtual bool isCompact() { return false; }
    virtual TR_IPBCDataCallGraph *asIPBCDataCallGraph() { return this; }
    int32_t getSumCount(TR::Compilation *comp);
    int32_t getSumCount(TR::Compilation *comp, bool);
+   // Sum of the weights that createPersistentCopy stores: the slots and the residue, but not the overflow slots
+   int32_t getPersistedSumCount();
    int32_t getEdgeWeight(TR_OpaqueClassBlock *clazz, TR::Compilation *comp);
    void updateEdgeWeight(TR_OpaqueClassBlock *clazz, int32_t weight);
    void printWeights(TR::Compilation *comp);
@@ -442,7 +475,10 @@ public:
    bool isLocked();
 
 private:
+   bool addToOverflow(uintptr_t v, uint32_t freq, int32_t &returnCount);
+
    CallSiteProfileInfo _csInfo;
+   CallSiteProfileOverflow * volatile _overflow;
    };
 
 class IProfilerBuffer : public TR_Link0<IProfilerBuffer>
@@ -493,6 +529,105 @@ private:
    TR_ReadSampleRequestsStats *_history; // My circular buffer
    };
 
+/**
+ * @class TR_IPBytecodeHashTable
+ * @brief Open addressing table that maps bytecode PCs to their IProfiler entries
+ *
+ * Each bucket fills one cache line: the tags (hash bits) of its slots followed by
+ * the entry pointers, so a lookup usually touches a single line of the table before
+ * reaching the matching entry. Collisions probe the next buckets.
+ *
+ * Lookups take no lock. Slots are never cleared, and an entry is fully constructed
+ * and its tag written before the slot pointer is published. Insertions and growth
+ * are serialized by a monitor. When the table grows, the previous bucket arrays
+ * are kept alive because readers may still be scanning them.
+ *
+ * Entries are bump allocated from large persistent segments, which avoids the
+ * per-allocation overhead of the persistent allocator. They are never freed.
+ */
+class TR_IPBytecodeHashTable
+   {
+public:
+   TR_PERSISTENT_ALLOC(TR_Memory::IProfiler)
+
+   enum EntryType
+      {
+      FourBytesEntry,
+      EightWordsEntry,
+      CallGraphEntry,
+      };
+
+   /**
+    * @brief Allocates the table
+    * @param initialBuckets Initial number of buckets; must be a power of two
+    * @return The new table or NULL if it could not be allocated
+    */
+   static TR_IPBytecodeHashTable *allocate(uint32_t initialBuckets);
+
+   TR_IPBytecodeHashTableEntry *find(uintptr_t pc) const;
+   /**
+    * @brief Returns the entry for the given pc, creating an entry of the given type if there is none
+    * @return The entry or NULL if memory could not be allocated
+    */
+   TR_IPBytecodeHashTableEntry *findOrCreate(uintptr_t pc, EntryType type);
+
+   uint32_t getNumEntries() const { return _numEntries; }
+
+   class Bucket;
+   class BucketArray;
+
+   /**
+    * @class Iterator
+    * @brief Visits the entries of a snapshot of the table; entries added concurrently may be missed
+    */
+   class Iterator
+      {
+   public:
+      Iterator(const TR_IPBytecodeHashTable *table);
+      TR_IPBytecodeHashTableEntry *next();
+   private:
+      const BucketArray *_array;
+      uint32_t           _bucket;
+      uint32_t           _slot;
+      };
+
+   static const uint32_t CACHE_LINE_SIZE = 64;
+   static const uint32_t SLOTS_PER_BUCKET = CACHE_LINE_SIZE / (sizeof(uint32_t) + sizeof(TR_IPBytecodeHashTableEntry *));
+
+   class Bucket
+      {
+   public:
+      uint32_t                               _tags[SLOTS_PER_BUCKET];
+      TR_IPBytecodeHashTableEntry * volatile _entries[SLOTS_PER_BUCKET];
+      };
+
+   class BucketArray
+      {
+   public:
+      BucketArray *_previous; // arrays replaced by growth, kept for concurrent readers
+      Bucket      *_buckets;  // cache line aligned
+      uint32_t     _mask;     // number of buckets - 1
+      };
+
+private:
+   static const size_t ARENA_SEGMENT_SIZE = 64 * 1024;
+
+   TR_IPBytecodeHashTable() : _monitor(NULL), _array(NULL), _numEntries(0), _arenaCursor(NULL), _arenaEnd(NULL) {}
+
+   static uint64_t hash(uintptr_t pc) { return (uint64_t)pc * 0x9E3779B97F4A7C15ULL; }
+   static TR_IPBytecodeHashTableEntry *find(const BucketArray *array, uintptr_t pc);
+   static bool insert(BucketArray *array, TR_IPBytecodeHashTableEntry *entry);
+   BucketArray *allocateBucketArray(uint32_t numBuckets);
+   bool grow();
+   void *allocateFromArena(size_t size);
+
+   TR::Monitor                  *_monitor;    // serializes insertions
+   BucketArray * volatile        _array;
+   uint32_t                      _numEntries;
+   uint8_t                      *_arenaCursor;
+   uint8_t                      *_arenaEnd;
+   };
+
 class TR_IProfiler : public TR_ExternalProfiler
    {
 public:
@@ -517,6 +652,21 @@ public:
    // this is registered as the BufferFullEvent handler
    UDATA parseBuffer(J9VMThread * vmThread, const U_8* dataStart, UDATA size, bool verboseReparse=false);
 
+   /**
+    * @brief A record of a profiling buffer, collected by parseBuffer before it is applied to the hash table
+    */
+   struct BufferedSample
+      {
+      uintptr_t _pc;
+      uintptr_t _data;
+      uint32_t  _seq; // arrival order; keeps the samples of one pc in the order they were recorded
+      };
+   static const uint32_t SAMPLE_BATCH_SIZE = 128;
+   /**
+    * @brief Applies a batch of samples grouped by pc, so consecutive samples of one bytecode share a single hash table lookup
+    */
+   void applySampleBatch(BufferedSample *samples, uint32_t numSamples);
+
    void printAllocationReport(); //Called by HookedByTheJIT
 
    bool isWarmCallGraphTooBig(TR_OpaqueMethodBlock *method, int32_t bcIndex, TR::Compilation *comp);
@@ -529,6 +679,17 @@ public:
    leave the TR_ResolvedMethodSymbol argument for debugging purpose when called from Ilgen
    */
    virtual void persistIprofileInfo(TR::ResolvedMethodSymbol *methodSymbol, TR_ResolvedMethod *method, TR::Compilation *comp); // JITServer: mark virtual
+   /**
+    * @brief Remembers a method whose profile is stored in the shared class cache so that
+    *        refreshPersistedProfiles can later update it with better sampled call-site weights
+    */
+   void registerPersistedMethod(J9ROMMethod *romMethod);
+   /**
+    * @brief Rewrites the call-site profiles stored in the shared class cache for which this JVM has
+    *        collected more samples. Does nothing unless TR::Options::_iprofilerPersistenceRefreshInterval
+    *        ms have passed since the last refresh. Must be called with VM access.
+    */
+   void refreshPersistedProfiles(J9VMThread *vmThread);
    bool elgibleForPersistIprofileInfo(TR::Compilation *comp) const;
 
    void checkMethodHashTable();
@@ -597,7 +758,7 @@ public:
    uintptr_t getSearchPC (TR_OpaqueMethodBlock *method, uint32_t byteCodeIndex, TR::Compilation *);
    static uintptr_t getSearchPCFromMethodAndBCIndex(TR_OpaqueMethodBlock *method, uint32_t byteCodeIndex);
    static uintptr_t getSearchPCFromMethodAndBCIndex(TR_OpaqueMethodBlock *method, uint32_t byteCodeIndex, TR::Compilation * comp);
-   virtual TR_IPBytecodeHashTableEntry *searchForSample(uintptr_t pc, int32_t bucket);
+   virtual TR_IPBytecodeHashTableEntry *searchForSample(uintptr_t pc);
    virtual TR_IPMethodHashTableEntry *searchForMethodSample(TR_OpaqueMethodBlock *omb, int32_t bucket);
 
 protected:
@@ -633,8 +794,10 @@ private:
    void copyDataFromEntry(TR_IPBytecodeHashTableEntry *oldEntry, TR_IPBytecodeHashTableEntry *newEntry, TR_IProfiler *ip);
 
    TR_IPBCDataStorageHeader *getJ9SharedDataDescriptorForMethod(J9SharedDataDescriptor * descriptor, unsigned char * buffer, uint32_t length, TR_OpaqueMethodBlock * method, TR::Compilation *comp);
+   uint32_t refreshPersistedProfile(J9VMThread *vmThread, TR_J9SharedCache *sharedCache, J9ROMMethod *romMethod);
+   uint32_t refreshPersistedEntries(J9VMThread *vmThread, TR_J9SharedCache *sharedCache, J9ROMMethod *romMethod,
+                                    uint8_t *record, TR_IPBCDataStorageHeader *node);
 
-   static int32_t bcHash (uintptr_t);
    static int32_t allocHash (uintptr_t);
 
    static int32_t methodHash(uintptr_t pc);
@@ -650,7 +813,7 @@ private:
    TR_IPBCDataStorageHeader * persistentProfilingSample (TR_OpaqueMethodBlock *method, uint32_t byteCodeIndex, TR::Compilation *comp, bool *methodProfileExistsInSCC, TR_IPBCDataStorageHeader *store);
 
    TR_IPBCDataAllocation *profilingAllocSample (uintptr_t pc, uintptr_t data, bool addIt);
-   TR_IPBytecodeHashTableEntry *findOrCreateEntry (int32_t bucket, uintptr_t pc, bool addIt);
+   TR_IPBytecodeHashTableEntry *findOrCreateEntry (uintptr_t pc, bool addIt);
    TR_IPBCDataAllocation *findOrCreateAllocEntry (int32_t bucket, uintptr_t pc, bool addIt);
    TR_OpaqueMethodBlock * getMethodFromNode(TR::Node *node, TR::Compilation *comp);
    bool addSampleData(TR_IPBytecodeHashTableEntry *entry, uintptr_t data, bool isRIData = false, uint32_t freq = 1);
@@ -687,7 +850,7 @@ private:
 
    // bytecode hashtable
    protected:
-   TR_IPBytecodeHashTableEntry   **_bcHashTable;
+   TR_IPBytecodeHashTable         *_bcHashTable;
    private:
 #if defined(EXPERIMENTAL_IPROFILER)
    // bytecode hashtable
@@ -711,13 +874,26 @@ private:
    volatile int32_t                _numOutstandingBuffers;
    uint64_t                        _numRequests;
    uint64_t                        _numRequestsSkipped;
+   uint64_t                        _numRequestsSkippedOutstandingBuffers; // part of _numRequestsSkipped
+   uint64_t                        _numRequestsSkippedLoadFactor;         // part of _numRequestsSkipped
+   uint64_t                        _numRequestsProcessedByAppThread;
    uint64_t                        _numRequestsHandedToIProfilerThread;
    volatile uint32_t               _iprofilerThreadExitFlag;
    volatile bool                   _iprofilerThreadAttachAttempted;
    uint64_t                        _iprofilerNumRecords; // info stats only
+   uint64_t                        _iprofilerNumEntryLookups; // info stats only
 
    TR_IPMethodHashTableEntry       **_methodHashTable;
 
+   // Methods with a profile in the shared class cache, refreshed round-robin by refreshPersistedProfiles
+   static const uint32_t            PERSISTENCE_REFRESH_BATCH_SIZE = 64; // methods per refresh
+   TR::Monitor                    *_persistedMethodsMonitor;
+   PersistentUnorderedSet<J9ROMMethod *> *_persistedMethodsSet;
+   PersistentVector<J9ROMMethod *> *_persistedMethods;
+   size_t                          _persistedMethodsCursor;
+   uint64_t                        _lastPersistenceRefreshTime; // ms
+   uint64_t                        _numPersistedEntriesRefreshed; // info stats only
+
    uint32_t                        _iprofilerBufferSize;
    TR_ReadSampleRequestsHistory   *_readSampleRequestsHistory;
 
@@ -468,7 +468,16 @@ J9::CodeCacheManager::allocateCodeCacheSegment(size_t segmentSize,
    mcc_printf("TR::CodeCache::allocate : size of codeCacheSegment = %d\n",codeCacheSegment->size);
 
    if (config.verboseCodeCache())
-      TR_VerboseLog::writeLineLocked(TR_Vlog_CODECACHE, "allocated code cache segment of size %u", codeCacheSizeToAllocate);
+      {
+      // The page size actually used determines how many iTLB entries the segment needs;
+      // the port library silently falls back to the default page size if large pages are unavailable
+      UDATA actualPageSize = codeCacheSegment->vmemIdentifier.pageSize;
+      TR_VerboseLog::writeLineLocked(TR_Vlog_CODECACHE, "allocated code cache segment of size %u backed by %u byte pages (%u pages)",
+         codeCacheSizeToAllocate, (uint32_t)actualPageSize, actualPageSize ? (uint32_t)(codeCacheSizeToAllocate / actualPageSize) : 0);
+      if (largeCodePageSize > 0 && actualPageSize < largeCodePageSize)
+         TR_VerboseLog::writeLineLocked(TR_Vlog_CODECACHE, "requested code cache page size %u was not available",
+            (uint32_t)largeCodePageSize);
+      }
 
    TR::CodeCacheMemorySegment *memSegment = (TR::CodeCacheMemorySegment *) self()->getMemory(sizeof(TR::CodeCacheMemorySegment));
    new (memSegment) TR::CodeCacheMemorySegment(codeCacheSegment);
@@ -669,7 +678,11 @@ J9::CodeCacheManager::almostOutOfCodeCache()
          CacheListCriticalSection scanCacheList(self());
          for (TR::CodeCache *codeCache = self()->getFirstCodeCache(); codeCache; codeCache = codeCache->next())
             {
-            if (codeCache->getFreeContiguousSpace() >= config.lowCodeCacheThreshold())
+            // Space reclaimed from unloaded or recompiled bodies is reused by later
+            // allocations, so a large enough free block counts as available space
+            // even when the contiguous area at the end of the cache is exhausted
+            if (codeCache->getFreeContiguousSpace() >= config.lowCodeCacheThreshold() ||
+                codeCache->getSizeOfLargestFreeWarmBlock() >= config.lowCodeCacheThreshold())
                {
                foundSpace = true;
                break;
@@ -707,7 +720,8 @@ J9::CodeCacheManager::printRemainingSpaceInCodeCaches()
    CacheListCriticalSection scanCacheList(self());
    for (TR::CodeCache *codeCache = self()->getFirstCodeCache(); codeCache; codeCache = codeCache->next())
       {
-      fprintf(stderr, "cache %p has %lu bytes empty\n", codeCache, codeCache->getFreeContiguousSpace());
+      fprintf(stderr, "cache %p has %lu bytes empty, largest reclaimed warm block %lu bytes\n",
+              codeCache, codeCache->getFreeContiguousSpace(), (unsigned long)codeCache->getSizeOfLargestFreeWarmBlock());
       if (codeCache->isReserved())
          fprintf(stderr, "Above cache is reserved by compThread %d\n", codeCache->getReservingCompThreadID());
       }
@@ -65,6 +65,14 @@ ClientSessionData::ClientSessionData(uint64_t clientUID, uint32_t seqNo, TR_Pers
    _vmInfo = NULL;
    _staticMapMonitor = TR::Monitor::create("JIT-JITServerStaticMapMonitor");
    _markedForDeletion = false;
+   _schedulingWeight = 1;
+   _schedulingVirtualTime = 0;
+   _numScheduledCompilations = 0;
+   _numCompletedScheduledCompilations = 0;
+   _totalScheduledCompTime = 0;
+   _numQueuedRequests = 0;
+   _totalQueueWaitTime = 0;
+   _maxQueueWaitTime = 0;
    _thunkSetMonitor = TR::Monitor::create("JIT-JITServerThunkSetMonitor");
 
    _bClassUnloadingAttempt = false;
@@ -364,6 +372,69 @@ ClientSessionData::printStats()
    j9tty_printf(PORTLIB, "\tTotal size of cached ROM classes + methods: %d bytes\n", total);
    }
 
+void
+ClientSessionData::setSchedulingWeight(int32_t weight)
+   {
+   // The weight is chosen by the client, so keep it within reasonable bounds
+   // to prevent one client from monopolizing the server
+   static const int32_t MAX_SCHEDULING_WEIGHT = 100;
+   if (weight < 1)
+      weight = 1;
+   else if (weight > MAX_SCHEDULING_WEIGHT)
+      weight = MAX_SCHEDULING_WEIGHT;
+   _schedulingWeight = weight;
+   }
+
+// Return the virtual time at which the next compilation of this client would start.
+// A client that was idle does not get credit for the time it did not use the server,
+// and compilations already in progress are accounted for with the average compilation
+// time of this client, since they are only charged when they complete.
+// Must be executed with compilation monitor in hand.
+uint64_t
+ClientSessionData::getSchedulingStartTime(uint64_t virtualClock) const
+   {
+   uint64_t startTime = (_schedulingVirtualTime > virtualClock) ? _schedulingVirtualTime : virtualClock;
+   if (_numCompletedScheduledCompilations)
+      startTime += _numScheduledCompilations * (_totalScheduledCompTime / _numCompletedScheduledCompilations) / _schedulingWeight;
+   return startTime;
+   }
+
+// Called when a compilation thread picks a request of this client from the
+// compilation queue after the request spent `queueWaitTime` ms in the queue.
+// Must be executed with compilation monitor in hand.
+void
+ClientSessionData::recordScheduledCompilation(uint64_t virtualClock, uint64_t queueWaitTime)
+   {
+   if (_schedulingVirtualTime < virtualClock)
+      _schedulingVirtualTime = virtualClock;
+   ++_numScheduledCompilations;
+   ++_numQueuedRequests;
+   _totalQueueWaitTime += queueWaitTime;
+   if (queueWaitTime > _maxQueueWaitTime)
+      _maxQueueWaitTime = queueWaitTime;
+   }
+
+// Charge the compilation time to this client according to its weight.
+// Must be executed with compilation monitor in hand.
+void
+ClientSessionData::recordCompletedScheduledCompilation(uint64_t compTimeUsec)
+   {
+   TR_ASSERT(_numScheduledCompilations > 0, "_numScheduledCompilations=%d must be positive", _numScheduledCompilations);
+   --_numScheduledCompilations;
+   ++_numCompletedScheduledCompilations;
+   _totalScheduledCompTime += compTimeUsec;
+   _schedulingVirtualTime += compTimeUsec / _schedulingWeight;
+   }
+
+// Must be executed with compilation monitor and vlog in hand
+void
+ClientSessionData::printSchedulingStats() const
+   {
+   TR_VerboseLog::writeLine(TR_Vlog_JITServer, "Client %llu: weight %u  compilations in progress %d  queued requests %llu  avg queue wait %llu ms  max queue wait %llu ms",
+      (unsigned long long)_clientUID, _schedulingWeight, _numScheduledCompilations, (unsigned long long)_numQueuedRequests,
+      (unsigned long long)(_numQueuedRequests ? _totalQueueWaitTime / _numQueuedRequests : 0), (unsigned long long)_maxQueueWaitTime);
+   }
+
 ClientSessionData::ClassInfo::ClassInfo() :
    _romClass(NULL),
    _remoteRomClass(NULL),
@@ -701,16 +772,18 @@ ClientSessionHT::ClientSessionHT() : _clientSessionMap(decltype(_clientSessionMa
    {
    PORT_ACCESS_FROM_PORT(TR::Compiler->portLib);
    _timeOfLastPurge = j9time_current_time_millis();
+   _schedulingVirtualClock = 0;
+   _numPurgedSessions = 0;
    _clientSessionMap.reserve(250); // allow room for at least 250 clients
    }
 
 // The destructor is currently never called because the server does not exit cleanly
 ClientSessionHT::~ClientSessionHT()
    {
-   for (auto iter = _clientSessionMap.begin(); iter != _clientSessionMap.end(); ++iter)
+   for (auto iter = _clientSessionMap.begin(); iter != _clientSessionMap.end(); )
       {
       ClientSessionData::destroy(iter->second); // delete the client data
-      _clientSessionMap.erase(iter); // delete the mapping from the hashtable
+      iter = _clientSessionMap.erase(iter); // delete the mapping from the hashtable
       }
    }
 
@@ -831,6 +904,14 @@ ClientSessionHT::findClientSession(uint64_t clientUID)
    return clientData;
    }
 
+// Must have compilation monitor in hand when calling this function.
+ClientSessionData *
+ClientSessionHT::peekClientSession(uint64_t clientUID) const
+   {
+   auto clientDataIt = _clientSessionMap.find(clientUID);
+   return (clientDataIt != _clientSessionMap.end()) ? clientDataIt->second : NULL;
+   }
+
 
 // Purge the old client session data from the hashtable and
 // update the timeOfLastPurge.
@@ -857,7 +938,8 @@ ClientSessionHT::purgeOldDataIfNeeded()
          }
       // Time for a purge operation.
       // Scan the entire table and delete old elements that are not in use
-      for (auto iter = _clientSessionMap.begin(); iter != _clientSessionMap.end(); ++iter)
+      // erase() invalidates the iterator it is given, so advance using its return value
+      for (auto iter = _clientSessionMap.begin(); iter != _clientSessionMap.end(); )
          {
          TR_ASSERT(iter->second->getInUse() >= 0, "_inUse=%d must be positive\n", iter->second->getInUse());
          if (iter->second->getInUse() == 0 &&
@@ -867,12 +949,15 @@ ClientSessionHT::purgeOldDataIfNeeded()
                TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "Server will purge session data for clientUID %llu of age %lld", 
                (unsigned long long)iter->first, (long long)oldAge);
             ClientSessionData::destroy(iter->second); // delete the client data
-            _clientSessionMap.erase(iter); // delete the mapping from the hashtable
+            iter = _clientSessionMap.erase(iter); // delete the mapping from the hashtable
+            _numPurgedSessions++;
+            }
+         else
+            {
+            ++iter;
             }
          }
       _timeOfLastPurge = crtTime;
-
-      // JITServer TODO: keep stats on how many elements were purged
       }
    }
 
@@ -891,3 +976,11 @@ ClientSessionHT::printStats()
       session.second->printStats();
       }
    }
+
+// Must have compilation monitor and vlog in hand when calling this function.
+void
+ClientSessionHT::printSchedulingStats() const
+   {
+   for (auto &session : _clientSessionMap)
+      session.second->printSchedulingStats();
+   }
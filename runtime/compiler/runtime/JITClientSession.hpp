@@ -399,6 +399,17 @@ class ClientSessionData
    void decNumActiveThreads() { --_numActiveThreads; }
    void printStats();
 
+   // Fair-share scheduling of compilations among clients.
+   // All the methods below must be executed with compilation monitor in hand.
+   uint32_t getSchedulingWeight() const { return _schedulingWeight; }
+   void setSchedulingWeight(int32_t weight);
+   uint64_t getSchedulingVirtualTime() const { return _schedulingVirtualTime; }
+   uint64_t getSchedulingStartTime(uint64_t virtualClock) const;
+   int32_t getNumScheduledCompilations() const { return _numScheduledCompilations; }
+   void recordScheduledCompilation(uint64_t virtualClock, uint64_t queueWaitTime);
+   void recordCompletedScheduledCompilation(uint64_t compTimeUsec);
+   void printSchedulingStats() const;
+
    void markForDeletion() { _markedForDeletion = true; }
    bool isMarkedForDeletion() const { return _markedForDeletion; }
 
@@ -479,6 +490,15 @@ class ClientSessionData
                              // could be just starting or waiting in _OOSequenceEntryList
    VMInfo *_vmInfo; // info specific to a client VM that does not change, NULL means not set
    bool _markedForDeletion; //Client Session is marked for deletion. When the inUse count will become zero this will be deleted.
+   // Fields used for fair-share scheduling of compilations; accessed with compilation monitor in hand
+   uint32_t _schedulingWeight; // share of compilation time relative to other clients, as requested by the client
+   uint64_t _schedulingVirtualTime; // compilation time (usec) consumed by this client, divided by its weight
+   int32_t _numScheduledCompilations; // compilations dequeued for this client that have not finished yet
+   uint64_t _numCompletedScheduledCompilations;
+   uint64_t _totalScheduledCompTime; // usec
+   uint64_t _numQueuedRequests; // requests of this client that went through the compilation queue
+   uint64_t _totalQueueWaitTime; // ms
+   uint64_t _maxQueueWaitTime; // ms
    TR_AddressSet *_unloadedClassAddresses; // Per-client versions of the unloaded class and method addresses kept in J9PersistentInfo
    bool           _requestUnloadedClasses; // If true we need to request the current state of unloaded classes from the client
    TR::Monitor *_staticMapMonitor;
@@ -535,14 +555,29 @@ class ClientSessionHT
    ClientSessionData * findOrCreateClientSession(uint64_t clientUID, uint32_t seqNo, bool *newSessionWasCreated, J9JITConfig *jitConfig);
    bool deleteClientSession(uint64_t clientUID, bool forDeletion);
    ClientSessionData * findClientSession(uint64_t clientUID);
+   // Same as findClientSession, but without side effects on the session
+   ClientSessionData * peekClientSession(uint64_t clientUID) const;
    void purgeOldDataIfNeeded();
    void printStats();
+   void printSchedulingStats() const;
+   // The virtual clock of the fair-share scheduler is the virtual time of the last client picked for a compilation.
+   // Must be accessed with compilation monitor in hand.
+   uint64_t getSchedulingVirtualClock() const { return _schedulingVirtualClock; }
+   void advanceSchedulingVirtualClock(uint64_t virtualTime)
+      {
+      if (virtualTime > _schedulingVirtualClock)
+         _schedulingVirtualClock = virtualTime;
+      }
    uint32_t size() const { return _clientSessionMap.size(); }
+   // Number of sessions purged because their client was inactive for too long
+   uint64_t getNumPurgedSessions() const { return _numPurgedSessions; }
 
    private:
    PersistentUnorderedMap<uint64_t, ClientSessionData*> _clientSessionMap;
 
    uint64_t _timeOfLastPurge;
+   uint64_t _schedulingVirtualClock;
+   uint64_t _numPurgedSessions;
    TR::CompilationInfo *_compInfo;
    const int64_t TIME_BETWEEN_PURGES; // ms; this defines how often we are willing to scan for old entries to be purged
    const int64_t OLD_AGE;// ms; this defines what an old entry means
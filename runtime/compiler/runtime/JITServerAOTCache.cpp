@@ -0,0 +1,167 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+#include "control/CompilationRuntime.hpp"
+#include "env/CompilerEnv.hpp"
+#include "infra/CriticalSection.hpp"
+#include "runtime/JITServerAOTCache.hpp"
+#include "j9.h"
+#include "rommeth.h"
+
+
+struct JITServerAOTCache::Entry
+   {
+   Entry(const std::string &codeCache, const std::string &dataCache) :
+      _codeSize(codeCache.size()), _dataSize(dataCache.size())
+      {
+      memcpy(_data, codeCache.data(), _codeSize);
+      memcpy(_data + _codeSize, dataCache.data(), _dataSize);
+      }
+
+   static size_t size(const std::string &codeCache, const std::string &dataCache)
+      {
+      return sizeof(Entry) + codeCache.size() + dataCache.size();
+      }
+
+   const size_t _codeSize;
+   const size_t _dataSize;
+   uint8_t _data[];// serialized code cache followed by serialized data cache
+   };
+
+
+static uint32_t
+getROMMethodIndex(const J9ROMClass *romClass, const J9ROMMethod *romMethod)
+   {
+   J9ROMMethod *method = J9ROMCLASS_ROMMETHODS(romClass);
+   for (uint32_t i = 0; i < romClass->romMethodCount; ++i)
+      {
+      if (method == romMethod)
+         return i;
+      method = nextROMMethod(method);
+      }
+   TR_ASSERT_FATAL(false, "ROMMethod %p not found in ROMClass %p", romMethod, romClass);
+   return 0;
+   }
+
+JITServerAOTCacheKey::JITServerAOTCacheKey(const std::string &cacheName, const J9ROMClass *romClass,
+                                           const J9ROMMethod *romMethod, int32_t optLevel) :
+   _cacheName(cacheName), _classHash(romClass),
+   _methodIndex(getROMMethodIndex(romClass, romMethod)), _optLevel(optLevel)
+   {
+   }
+
+
+JITServerAOTCache::JITServerAOTCache(size_t maxSize) :
+   _monitor(TR::Monitor::create("JIT-JITServerAOTCacheMonitor")),
+   _map(decltype(_map)::allocator_type(TR::Compiler->persistentGlobalAllocator())),
+   _identities(decltype(_identities)::allocator_type(TR::Compiler->persistentGlobalAllocator())),
+   _maxSize(maxSize), _size(0), _numHits(0), _numMisses(0)
+   {
+   if (!_monitor)
+      throw std::bad_alloc();
+   }
+
+JITServerAOTCache::~JITServerAOTCache()
+   {
+   for (const auto &kv : _map)
+      TR::Compiler->persistentGlobalAllocator().deallocate(kv.second);
+   TR::Monitor::destroy(_monitor);
+   }
+
+
+bool
+JITServerAOTCache::store(const JITServerAOTCacheKey &key, const std::string &codeCache, const std::string &dataCache)
+   {
+   size_t size = Entry::size(codeCache, dataCache);
+
+      {
+      OMR::CriticalSection aotCache(_monitor);
+      if ((_size + size > _maxSize) || (_map.find(key) != _map.end()))
+         return false;
+      }
+
+   // Copy the method body outside of the critical section to reduce lock contention
+   void *ptr = TR::Compiler->persistentGlobalMemory()->allocatePersistentMemory(size, TR_Memory::PersistentInfo);
+   if (!ptr)
+      return false;
+   auto entry = new (ptr) Entry(codeCache, dataCache);
+
+   bool inserted = false;
+   try
+      {
+      OMR::CriticalSection aotCache(_monitor);
+      // Another thread could have stored the same method or filled the cache in the meantime
+      if (_size + size <= _maxSize)
+         {
+         inserted = _map.insert({ key, entry }).second;
+         if (inserted)
+            _size += size;
+         }
+      }
+   catch (const std::bad_alloc &)
+      {
+      }
+
+   if (!inserted)
+      TR::Compiler->persistentGlobalAllocator().deallocate(entry);
+   return inserted;
+   }
+
+bool
+JITServerAOTCache::find(const JITServerAOTCacheKey &key, std::string &codeCache, std::string &dataCache)
+   {
+   // Entries are never removed while the server is running, so the
+   // contents can be safely copied outside of the critical section
+   const Entry *entry = NULL;
+      {
+      OMR::CriticalSection aotCache(_monitor);
+      auto it = _map.find(key);
+      if (it == _map.end())
+         {
+         ++_numMisses;
+         return false;
+         }
+      ++_numHits;
+      entry = it->second;
+      }
+
+   codeCache.assign((const char *)entry->_data, entry->_codeSize);
+   dataCache.assign((const char *)entry->_data + entry->_codeSize, entry->_dataSize);
+   return true;
+   }
+
+bool
+JITServerAOTCache::isCompatibleClient(const std::string &cacheName, const std::string &identity)
+   {
+   if (identity.empty())
+      return false;
+
+   try
+      {
+      OMR::CriticalSection aotCache(_monitor);
+      auto it = _identities.insert({ cacheName, identity }).first;
+      return it->second == identity;
+      }
+   catch (const std::bad_alloc &)
+      {
+      return false;
+      }
+   }
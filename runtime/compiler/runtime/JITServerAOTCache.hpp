@@ -0,0 +1,110 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+#ifndef JITSERVER_AOT_CACHE_H
+#define JITSERVER_AOT_CACHE_H
+
+#include <string>
+#include "env/TRMemory.hpp"
+#include "env/PersistentCollections.hpp"
+#include "infra/Monitor.hpp"
+#include "runtime/JITServerROMClassHash.hpp"
+
+struct J9ROMClass;
+struct J9ROMMethod;
+
+
+// Identifies an AOT compiled method independently of the client that requested it.
+// A cached body refers to client data only through offsets into the shared class
+// cache, so it can only be reused by clients that run with an identical SCC. The
+// clients express this by specifying the same AOT cache name, which is part of the key.
+// The server only lets a client use a name if the client's AOT header and SCC layout
+// match those of the first client of that name (see isCompatibleClient()).
+struct JITServerAOTCacheKey
+   {
+   JITServerAOTCacheKey() : _methodIndex(0), _optLevel(0) { }
+   JITServerAOTCacheKey(const std::string &cacheName, const J9ROMClass *romClass,
+                        const J9ROMMethod *romMethod, int32_t optLevel);
+
+   bool operator==(const JITServerAOTCacheKey &k) const
+      {
+      return (_classHash == k._classHash) && (_methodIndex == k._methodIndex) &&
+             (_optLevel == k._optLevel) && (_cacheName == k._cacheName);
+      }
+
+   std::string _cacheName;
+   JITServerROMClassHash _classHash;
+   uint32_t _methodIndex;// index of the method in its ROMClass
+   int32_t _optLevel;
+   };
+
+
+// std::hash specialization for using JITServerAOTCacheKey as unordered map key
+namespace std
+   {
+   template<> struct hash<JITServerAOTCacheKey>
+      {
+      size_t operator()(const JITServerAOTCacheKey &k) const noexcept
+         {
+         // Clients rarely use more than one cache name, so it is not included in the hash
+         return std::hash<JITServerROMClassHash>()(k._classHash) ^ ((size_t)k._methodIndex << 4) ^ (size_t)k._optLevel;
+         }
+      };
+   }
+
+
+// Stores relocatable method bodies compiled by the server so that they can be
+// sent to other clients that request the same method without recompiling it.
+class JITServerAOTCache
+   {
+public:
+   TR_PERSISTENT_ALLOC(TR_Memory::PersistentInfo)
+
+   JITServerAOTCache(size_t maxSize);
+   ~JITServerAOTCache();
+
+   // Returns false if the method is already cached or if the cache is full
+   bool store(const JITServerAOTCacheKey &key, const std::string &codeCache, const std::string &dataCache);
+   // Returns false if the method is not cached; otherwise copies the cached code and data
+   bool find(const JITServerAOTCacheKey &key, std::string &codeCache, std::string &dataCache);
+   // The first client that uses a cache name determines the SCC identity of that name.
+   // Returns false if the given identity is different, i.e. the client must not use the cache.
+   bool isCompatibleClient(const std::string &cacheName, const std::string &identity);
+
+   size_t getNumMethods() const { return _map.size(); }
+   size_t getSize() const { return _size; }
+   size_t getNumHits() const { return _numHits; }
+   size_t getNumMisses() const { return _numMisses; }
+
+private:
+   struct Entry;
+
+   TR::Monitor *const _monitor;
+   PersistentUnorderedMap<JITServerAOTCacheKey, Entry *> _map;
+   PersistentUnorderedMap<std::string, std::string> _identities;// cache name -> SCC identity of its clients
+   const size_t _maxSize;
+   size_t _size;
+   size_t _numHits;
+   size_t _numMisses;
+   };
+
+
+#endif /* JITSERVER_AOT_CACHE_H */
@@ -25,6 +25,8 @@
 #include "env/VMJ9.h" // for TR_JitPrivateConfig
 #include "env/VerboseLog.hpp"
 #include "control/CompilationRuntime.hpp" // for CompilatonInfo
+#include "net/CommunicationStream.hpp" // for message compression statistics
+#include "runtime/JITServerAOTCache.hpp"
 
 JITServerStatisticsThread::JITServerStatisticsThread()
    : _statisticsThread(NULL), _statisticsThreadMonitor(NULL), _statisticsOSThread(NULL),
@@ -114,6 +116,7 @@ static int32_t J9THREAD_PROC statisticsThreadProc(void * entryarg)
                }
             TR_VerboseLog::vlogAcquire();
             TR_VerboseLog::writeLine(TR_Vlog_JITServer, "Number of clients : %u", compInfo->getClientSessionHT()->size());
+            TR_VerboseLog::writeLine(TR_Vlog_JITServer, "Purged client sessions : %llu", (unsigned long long)compInfo->getClientSessionHT()->getNumPurgedSessions());
             TR_VerboseLog::writeLine(TR_Vlog_JITServer, "Total compilation threads : %d", compInfo->getNumUsableCompilationThreads());
             TR_VerboseLog::writeLine(TR_Vlog_JITServer, "Active compilation threads : %d",compInfo->getNumCompThreadsActive());
             bool incompleteInfo;
@@ -122,7 +125,30 @@ static int32_t J9THREAD_PROC statisticsThreadProc(void * entryarg)
                {
                TR_VerboseLog::writeLine(TR_Vlog_JITServer, "CpuLoad %d%% (AvgUsage %d%%) JvmCpu %d%%", cpuUsage, avgCpuUsage, vmCpuUsage);
                }
+            if (JITServer::CommunicationStream::getNumMessagesCompressed() != 0)
+               {
+               uint64_t bytesBefore = JITServer::CommunicationStream::getNumBytesBeforeCompression();
+               uint64_t bytesAfter = JITServer::CommunicationStream::getNumBytesAfterCompression();
+               TR_VerboseLog::writeLine(TR_Vlog_JITServer, "Compressed messages: %llu  bytes saved: %llu (%llu%%)  compression CPU: %llu ms  decompression CPU: %llu ms",
+                  JITServer::CommunicationStream::getNumMessagesCompressed(),
+                  bytesBefore - bytesAfter, (bytesBefore - bytesAfter) * 100 / bytesBefore,
+                  JITServer::CommunicationStream::getCompressionCPUTime() / 1000000,
+                  JITServer::CommunicationStream::getDecompressionCPUTime() / 1000000);
+               }
+            if (auto aotCache = compInfo->getJITServerAOTCache())
+               {
+               TR_VerboseLog::writeLine(TR_Vlog_JITServer, "AOT cache: %zu methods  %zu KB  hits: %zu  misses: %zu",
+                  aotCache->getNumMethods(), aotCache->getSize() >> 10, aotCache->getNumHits(), aotCache->getNumMisses());
+               }
             TR_VerboseLog::vlogRelease();
+
+               {
+               // Compilation monitor must be acquired before the vlog to avoid deadlocks
+               OMR::CriticalSection compilationMonitorLock(compInfo->getCompilationMonitor());
+               TR_VerboseLog::vlogAcquire();
+               compInfo->getClientSessionHT()->printSchedulingStats();
+               TR_VerboseLog::vlogRelease();
+               }
             lastStatsTime = crtTime;
             }
             
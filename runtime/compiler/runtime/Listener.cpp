@@ -27,7 +27,7 @@
 #include <netinet/in.h>
 #include <netinet/tcp.h>	/* for TCP_NODELAY option */
 #include <openssl/err.h>
-#include <poll.h>
+#include <sys/epoll.h>
 #include <sys/types.h>
 #include <sys/socket.h>
 #include <sys/un.h>
@@ -186,10 +186,31 @@ acceptOpenSSLConnection(SSL_CTX *sslCtx, int connfd, BIO *&bio)
 
 TR_Listener::TR_Listener()
    : _listenerThread(NULL), _listenerMonitor(NULL), _listenerOSThread(NULL),
-   _listenerThreadAttachAttempted(false), _listenerThreadExitFlag(false)
+   _listenerThreadAttachAttempted(false), _listenerThreadExitFlag(false), _epollfd(-1)
    {
    }
 
+bool
+TR_Listener::addIdleStream(JITServer::ServerStream *stream)
+   {
+   int epollfd = _epollfd;
+   if ((epollfd < 0) || stream->hasBufferedInput())
+      return false;
+
+   // The stream is registered for a single event; the listener removes it from the epoll set
+   // before dispatching it, so each stream is handled by at most one thread at any time
+   struct epoll_event event = {0};
+   event.events = EPOLLIN | EPOLLRDHUP | EPOLLONESHOT;
+   event.data.ptr = stream;
+   if (epoll_ctl(epollfd, EPOLL_CTL_ADD, stream->getSocketFD(), &event) < 0)
+      {
+      if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+         TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "Error adding stream %p to the listener: errno=%d", stream, errno);
+      return false;
+      }
+   return true;
+   }
+
 void
 TR_Listener::serveRemoteCompilationRequests(BaseCompileDispatcher *compiler)
    {
@@ -203,7 +224,6 @@ TR_Listener::serveRemoteCompilationRequests(BaseCompileDispatcher *compiler)
 
    uint32_t port = info->getJITServerPort();
    uint32_t timeoutMs = info->getSocketTimeout();
-   struct pollfd pfd = {0};
    int sockfd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK, 0);
    if (sockfd < 0)
       {
@@ -241,22 +261,32 @@ TR_Listener::serveRemoteCompilationRequests(BaseCompileDispatcher *compiler)
       exit(1);
       }
 
-   pfd.fd = sockfd;
-   pfd.events = POLLIN;
+   int epollfd = epoll_create1(EPOLL_CLOEXEC);
+   if (epollfd < 0)
+      {
+      perror("can't create epoll instance");
+      exit(1);
+      }
+   // The listening socket is identified by a NULL pointer; idle streams by the stream pointer
+   struct epoll_event listenEvent = {0};
+   listenEvent.events = EPOLLIN;
+   listenEvent.data.ptr = NULL;
+   if (epoll_ctl(epollfd, EPOLL_CTL_ADD, sockfd, &listenEvent) < 0)
+      {
+      perror("can't add listening socket to epoll instance");
+      exit(1);
+      }
+   _epollfd = epollfd;
 
+   struct epoll_event events[OPENJ9_LISTENER_MAX_EVENTS];
    while (!getListenerThreadExitFlag())
       {
-      int32_t rc = 0;
-      struct sockaddr_in cli_addr;
-      socklen_t clilen = sizeof(cli_addr);
-      int connfd = -1;
-
-      rc = poll(&pfd, 1, OPENJ9_LISTENER_POLL_TIMEOUT);
-      if (getListenerThreadExitFlag()) // if we are exiting, no need to check poll() status
+      int32_t rc = epoll_wait(epollfd, events, OPENJ9_LISTENER_MAX_EVENTS, OPENJ9_LISTENER_POLL_TIMEOUT);
+      if (getListenerThreadExitFlag()) // if we are exiting, no need to check epoll_wait() status
          {
          break;
          }
-      else if (0 == rc) // poll() timed out and no fd is ready
+      else if (0 == rc) // epoll_wait() timed out and no fd is ready
          {
          continue;
          }
@@ -268,54 +298,36 @@ TR_Listener::serveRemoteCompilationRequests(BaseCompileDispatcher *compiler)
             }
          else
             {
-            perror("error in polling listening socket");
+            perror("error in polling sockets");
             exit(1);
             }
          }
-      else if (pfd.revents != POLLIN)
-         {
-         fprintf(stderr, "Unexpected event occurred during poll for new connection: revents=%d\n", pfd.revents);
-         exit(1);
-         }
-      do
+
+      for (int32_t i = 0; i < rc; ++i)
          {
-         /* at this stage we should have a valid request for new connection */
-         connfd = accept(sockfd, (struct sockaddr *)&cli_addr, &clilen);
-         if (connfd < 0)
+         auto stream = (JITServer::ServerStream *)events[i].data.ptr;
+         if (stream)
             {
-            if ((EAGAIN != errno) && (EWOULDBLOCK != errno))
-               {
-               if (TR::Options::getVerboseOption(TR_VerboseJITServer))
-                  {
-                  TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "Error accepting connection: errno=%d", errno);
-                  }
-               }
+            // A new request arrived on an idle stream (or the client closed the connection,
+            // which the compilation thread will detect when reading from the stream)
+            epoll_ctl(epollfd, EPOLL_CTL_DEL, stream->getSocketFD(), NULL);
+            compiler->compile(stream);
+            }
+         else if (events[i].events != EPOLLIN)
+            {
+            fprintf(stderr, "Unexpected event occurred during poll for new connection: revents=%d\n", events[i].events);
+            exit(1);
             }
          else
             {
-            struct timeval timeoutMsForConnection = {(timeoutMs / 1000), ((timeoutMs % 1000) * 1000)};
-            if (setsockopt(connfd, SOL_SOCKET, SO_RCVTIMEO, (void *)&timeoutMsForConnection, sizeof(timeoutMsForConnection)) < 0)
-               {
-               perror("Can't set option SO_RCVTIMEO on connfd socket");
-               exit(1);
-               }
-            if (setsockopt(connfd, SOL_SOCKET, SO_SNDTIMEO, (void *)&timeoutMsForConnection, sizeof(timeoutMsForConnection)) < 0)
-               {
-               perror("Can't set option SO_SNDTIMEO on connfd socket");
-               exit(1);
-               }
-
-            BIO *bio = NULL;
-            if (sslCtx && !acceptOpenSSLConnection(sslCtx, connfd, bio))
-               continue;
-
-            JITServer::ServerStream *stream = new (TR::Compiler->persistentGlobalAllocator()) JITServer::ServerStream(connfd, bio);
-            compiler->compile(stream);
+            acceptConnections(sockfd, sslCtx, timeoutMs, compiler);
             }
-         } while ((-1 != connfd) && !getListenerThreadExitFlag());
+         }
       }
 
    // The following piece of code will be executed only if the server shuts down properly
+   _epollfd = -1;
+   close(epollfd);
    close(sockfd);
    if (sslCtx)
       {
@@ -324,6 +336,52 @@ TR_Listener::serveRemoteCompilationRequests(BaseCompileDispatcher *compiler)
       }
    }
 
+void
+TR_Listener::acceptConnections(int sockfd, SSL_CTX *sslCtx, uint32_t timeoutMs, BaseCompileDispatcher *compiler)
+   {
+   struct sockaddr_in cli_addr;
+   socklen_t clilen = sizeof(cli_addr);
+   int connfd = -1;
+   do
+      {
+      /* at this stage we should have a valid request for new connection */
+      connfd = accept(sockfd, (struct sockaddr *)&cli_addr, &clilen);
+      if (connfd < 0)
+         {
+         if ((EAGAIN != errno) && (EWOULDBLOCK != errno))
+            {
+            if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+               {
+               TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "Error accepting connection: errno=%d", errno);
+               }
+            }
+         }
+      else
+         {
+         struct timeval timeoutMsForConnection = {(timeoutMs / 1000), ((timeoutMs % 1000) * 1000)};
+         if (setsockopt(connfd, SOL_SOCKET, SO_RCVTIMEO, (void *)&timeoutMsForConnection, sizeof(timeoutMsForConnection)) < 0)
+            {
+            perror("Can't set option SO_RCVTIMEO on connfd socket");
+            exit(1);
+            }
+         if (setsockopt(connfd, SOL_SOCKET, SO_SNDTIMEO, (void *)&timeoutMsForConnection, sizeof(timeoutMsForConnection)) < 0)
+            {
+            perror("Can't set option SO_SNDTIMEO on connfd socket");
+            exit(1);
+            }
+
+         BIO *bio = NULL;
+         if (sslCtx && !acceptOpenSSLConnection(sslCtx, connfd, bio))
+            continue;
+
+         JITServer::ServerStream *stream = new (TR::Compiler->persistentGlobalAllocator()) JITServer::ServerStream(connfd, bio);
+         // Wait for the first compilation request in the listener
+         if (!addIdleStream(stream))
+            compiler->compile(stream);
+         }
+      } while ((-1 != connfd) && !getListenerThreadExitFlag());
+   }
+
 TR_Listener * TR_Listener::allocate()
    {
    TR_Listener * listener = new (PERSISTENT_NEW) TR_Listener();
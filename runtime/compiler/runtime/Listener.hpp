@@ -38,6 +38,7 @@
  */
 
 #define OPENJ9_LISTENER_POLL_TIMEOUT 100 // in milliseconds
+#define OPENJ9_LISTENER_MAX_EVENTS 64 // max number of socket events processed per epoll_wait() call
 
 class BaseCompileDispatcher;
 
@@ -51,21 +52,31 @@ public:
    /**
       @brief Function called to deal with incoming connection requests
 
-      This function opens a socket (non-blocking), binds it and then waits for incoming
-      connection by polling on it with a timeout (see OPENJ9_LISTENER_POLL_TIMEOUT).
-      If it ever comes out of polling (due to timeout or a new connection request),
-      it checks the exit flag. If the flag is set, then the thread exits.
-      Otherwise, it establishes the connection using accept().
+      This function opens a socket (non-blocking), binds it and then waits with epoll for
+      incoming connections and for compilation requests on idle streams, with a timeout
+      (see OPENJ9_LISTENER_POLL_TIMEOUT). If it ever comes out of waiting (due to timeout
+      or a socket event), it checks the exit flag. If the flag is set, then the thread exits.
+      Otherwise, it establishes new connections using accept().
       Once a connection is accepted a ServerStream object is created (receiving the newly
-      opened socket descriptor as a parameter) and passed to the compilation handler.
-      Typically, the compilation handler places the ServerStream object in a queue and
-      returns immediately so that other connection requests can be accepted.
+      opened socket descriptor as a parameter) and added to the set of idle streams.
+      When data arrives on an idle stream, the stream is removed from the set and passed to
+      the compilation handler. Typically, the compilation handler places the ServerStream object
+      in a queue and returns immediately so that other connection requests can be accepted.
+      This way, compilation threads are only used by streams that have a request to process,
+      regardless of how many clients are connected.
       Note: it must be executed on a separate thread as it needs to keep listening for new connections.
 
       @param [in] compiler Object that defines the behavior when a new connection is accepted
    */
    void serveRemoteCompilationRequests(BaseCompileDispatcher *compiler);
    int32_t waitForListenerThreadExit(J9JavaVM *javaVM);
+   /**
+      @brief Add a stream to the set of idle streams waiting for their next compilation request
+
+      Can be called from any thread. Returns false if the stream could not be added,
+      in which case the caller must dispatch the stream to a compilation thread.
+   */
+   bool addIdleStream(JITServer::ServerStream *stream);
    void setAttachAttempted(bool b) { _listenerThreadAttachAttempted = b; }
    bool getAttachAttempted() const { return _listenerThreadAttachAttempted; }
 
@@ -78,11 +89,15 @@ public:
    void setListenerThreadExitFlag() { _listenerThreadExitFlag = true; }
 
 private:
+   // Accept all pending connection requests on the listening socket
+   void acceptConnections(int sockfd, SSL_CTX *sslCtx, uint32_t timeoutMs, BaseCompileDispatcher *compiler);
+
    J9VMThread *_listenerThread;
    TR::Monitor *_listenerMonitor;
    j9thread_t _listenerOSThread;
    volatile bool _listenerThreadAttachAttempted;
    volatile bool _listenerThreadExitFlag;
+   volatile int _epollfd; // descriptor of the epoll instance used for waiting on sockets
    };
 
 /**
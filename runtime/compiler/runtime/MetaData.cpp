@@ -83,6 +83,9 @@ struct TR_StackAtlasStats
    uint32_t _counter;
    uint32_t _maxSlots;
    uint32_t _totalSlots;
+   uint32_t _totalMaps;
+   uint32_t _mergedMaps;    // maps emitted as a bytecode info range sharing the previous map's GC bits
+   uint64_t _totalAtlasBytes;
    } stackAtlasStats;
 
 static uint8_t * allocateGCData(TR_J9VMBase * vm, uint32_t numBytes, TR::Compilation *comp)
@@ -119,6 +122,9 @@ TR_StackAtlasStats::~TR_StackAtlasStats()
    printf("number of methods jitted:      %d\n", _counter);
    printf("av. # slots * 10:              %d\n", (_totalSlots * 10) / _counter);
    printf("max # slots:                   %d\n", _maxSlots);
+   printf("total # maps:                  %d\n", _totalMaps);
+   printf("# maps merged with previous:   %d\n", _mergedMaps);
+   printf("av. atlas size in bytes:       %d\n", (int32_t)(_totalAtlasBytes / _counter));
    fflush(stdout);
    }
 
@@ -961,11 +967,14 @@ createStackAtlas(
    TR::AutomaticSymbol * syncObjectTemp = methodSymbol->getSyncObjectTemp() ? methodSymbol->getSyncObjectTemp()->getSymbol()->getAutoSymbol() : 0;
    vmAtlas->paddingTo32 = (U_16)(syncObjectTemp && syncObjectTemp->getGCMapIndex() != -1 ? syncObjectTemp->getOffset() : -1);
 
-   if (debug("stackAtlasStats"))
+   bool collectStats = debug("stackAtlasStats") != NULL;
+   if (collectStats)
       {
       ++stackAtlasStats._counter;
       stackAtlasStats._totalSlots += numberOfSlotsMapped;
       stackAtlasStats._maxSlots = std::max(stackAtlasStats._maxSlots, numberOfSlotsMapped);
+      stackAtlasStats._totalMaps += trStackAtlas->getNumberOfMaps();
+      stackAtlasStats._totalAtlasBytes += atlasSizeInBytes;
       }
 
    mapIterator.reset();
@@ -988,6 +997,8 @@ createStackAtlas(
          {
          cursor -= sizeOfByteCodeInfoMap; //GET_SIZEOF_BYTECODEINFO_MAP(fourByteOffsets);
          createByteCodeInfoRange(mapCursor, cursor, fourByteOffsets, trStackAtlas, comp);
+         if (collectStats)
+            ++stackAtlasStats._mergedMaps;
          }
       else
          {
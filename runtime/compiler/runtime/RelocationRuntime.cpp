@@ -1007,10 +1007,9 @@ TR_SharedCacheRelocationRuntime::getCurrentLockwordOptionHashValue(J9JavaVM *vm)
    return currentLockwordOptionHashValue;
    }
 
-OMRProcessorDesc
-TR_SharedCacheRelocationRuntime::getProcessorDescriptionFromSCC(TR_FrontEnd *fe, J9VMThread *curThread)
+const TR_AOTHeader *
+TR_SharedCacheRelocationRuntime::getStoredAOTHeader(J9VMThread *curThread)
    {
-   TR_J9VMBase *fej9 = (TR_J9VMBase *)fe;
    J9SharedDataDescriptor firstDescriptor;
    firstDescriptor.address = NULL;
    javaVM()->sharedClassConfig->findSharedData(curThread,
@@ -1020,10 +1019,14 @@ TR_SharedCacheRelocationRuntime::getProcessorDescriptionFromSCC(TR_FrontEnd *fe,
                                              FALSE,
                                              &firstDescriptor,
                                              NULL);
+   return (const TR_AOTHeader *)firstDescriptor.address;
+   }
 
-   const void* result = firstDescriptor.address;
-   TR_ASSERT_FATAL(result, "No Shared Class Cache available for Processor Description\n");
-   TR_AOTHeader * hdrInCache = (TR_AOTHeader *)result;
+OMRProcessorDesc
+TR_SharedCacheRelocationRuntime::getProcessorDescriptionFromSCC(TR_FrontEnd *fe, J9VMThread *curThread)
+   {
+   const TR_AOTHeader *hdrInCache = getStoredAOTHeader(curThread);
+   TR_ASSERT_FATAL(hdrInCache, "No Shared Class Cache available for Processor Description\n");
    return hdrInCache->processorDescription;
    }
 
@@ -136,6 +136,8 @@ public:
 
 #if defined(J9VM_GC_REALTIME)
 	MM_ReferenceObjectList* referenceObjectLists; /**< A global array of lists of reference objects (i.e. weak/soft/phantom) */
+	UDATA targetUtilizationMinPercentage; /**< lower bound for the adaptive Metronome target utilization (0 disables adaptation) */
+	UDATA targetUtilizationMaxPercentage; /**< upper bound for the adaptive Metronome target utilization (0 disables adaptation) */
 #endif /* J9VM_GC_REALTIME */
 	MM_ObjectAccessBarrier* accessBarrier;
 
@@ -155,6 +157,11 @@ public:
 	
 	UDATA objectListFragmentCount; /**< the size of Local Object Buffer(per gc thread), used by referenceObjectBuffer, UnfinalizedObjectBuffer and OwnableSynchronizerObjectBuffer */
 
+#if defined(J9VM_GC_VLHGC)
+	UDATA tarokRememberedSetOverflowKickoffPercent; /**< percentage of regions with overflowed RSCLs at which the next GMP is kicked off without waiting for the remaining intermission (0 disables) */
+	UDATA tarokTargetMaxPauseTimeMillis; /**< PGC pause time goal in milliseconds used to cap the eden size (0 means no goal) */
+#endif /* defined(J9VM_GC_VLHGC) */
+
 	MM_Wildcard* numaCommonThreadClassNamePatterns; /**< A linked list of thread class names which should be associated with the common context */
 
 	struct {
@@ -182,6 +189,7 @@ public:
 
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
 	MM_IdleGCManager* idleGCManager; /**< Manager which registers for VM Runtime State notification & manages free heap on notification */
+	UDATA gcOnIdleMinimumIntervalMillis; /**< minimum time between two idle GCs, so heap released on one idle transition is not churned by the next (0 means no minimum) */
 #endif
 
 	double maxRAMPercent; /**< Value of -XX:MaxRAMPercentage specified by the user */
@@ -297,6 +305,10 @@ public:
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
 		, _stringTableListToTreeThreshold(1024)
 		, maxSoftReferenceAge(32)
+#if defined(J9VM_GC_REALTIME)
+		, targetUtilizationMinPercentage(0)
+		, targetUtilizationMaxPercentage(0)
+#endif /* J9VM_GC_REALTIME */
 #if defined(J9VM_GC_FINALIZATION)
 		, finalizeMainPriority(J9THREAD_PRIORITY_NORMAL)
 		, finalizeWorkerPriority(J9THREAD_PRIORITY_NORMAL)
@@ -307,6 +319,10 @@ public:
 #endif /* defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING) */
 		, unfinalizedObjectLists(NULL)
 		, objectListFragmentCount(0)
+#if defined(J9VM_GC_VLHGC)
+		, tarokRememberedSetOverflowKickoffPercent(5)
+		, tarokTargetMaxPauseTimeMillis(0)
+#endif /* defined(J9VM_GC_VLHGC) */
 		, numaCommonThreadClassNamePatterns(NULL)
 		, stringDedupPolicy(J9_JIT_STRING_DEDUP_POLICY_UNDEFINED)
 		, _asyncCallbackKey(-1)
@@ -314,6 +330,7 @@ public:
 		, _HeapManagementMXBeanBackCompatibilityEnabled(false)
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
 		, idleGCManager(NULL)
+		, gcOnIdleMinimumIntervalMillis(0)
 #endif
 		, maxRAMPercent(0.0) /* this would get overwritten by user specified value */
 		, initialRAMPercent(0.0) /* this would get overwritten by user specified value */
@@ -79,10 +79,23 @@ MM_IdleGCManager::manageFreeHeap(J9VMThread* currentThread)
 {
 	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(currentThread->omrVMThread);
 	MM_GCExtensions* _extensions = MM_GCExtensions::getExtensions(env);
+	PORT_ACCESS_FROM_JAVAVM(_javaVM);
+
+	/* With bursty load the VM may flip between active and idle quickly; releasing the free heap
+	 * again before the pages from the last release could have been reused only costs a GC
+	 */
+	if ((0 != _lastIdleGCTimeMillis) && (0 != _extensions->gcOnIdleMinimumIntervalMillis)) {
+		U_64 elapsedMillis = j9time_current_time_millis() - _lastIdleGCTimeMillis;
+		if (elapsedMillis < _extensions->gcOnIdleMinimumIntervalMillis) {
+			return;
+		}
+	}
 
 	_javaVM->internalVMFunctions->internalAcquireVMAccess(currentThread);
 	_extensions->heap->systemGarbageCollect(env, J9MMCONSTANT_EXPLICIT_GC_IDLE_GC);
 	_javaVM->internalVMFunctions->internalReleaseVMAccess(currentThread);
+
+	_lastIdleGCTimeMillis = j9time_current_time_millis();
 }
 
 extern "C" {
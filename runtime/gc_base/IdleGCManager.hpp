@@ -52,6 +52,7 @@ private:
 	 * reference to the language runtime
 	 */
 	J9JavaVM* _javaVM;
+	U_64 _lastIdleGCTimeMillis; /**< time at which the last idle GC completed (0 if none has run yet) */
 
 protected:
 public:
@@ -86,6 +87,7 @@ public:
 	MM_IdleGCManager(MM_EnvironmentBase* env)
 		: MM_BaseNonVirtual()
 		, _javaVM((J9JavaVM*)env->getOmrVM()->_language_vm)
+		, _lastIdleGCTimeMillis(0)
 	{
 		_typeId = __FUNCTION__;
 	}
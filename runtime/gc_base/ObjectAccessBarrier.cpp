@@ -1446,16 +1446,12 @@ MM_ObjectAccessBarrier::structuralCompareFlattenedObjects(J9VMThread *vmThread,
 			offset += referenceSize;
 		}
 	} else {
-		/* no instanceDescription bits needed on this path */
-
-		while (offset < limit) {
-			fomrobject_t lhsValue = GC_SlotObject::readSlot((fomrobject_t*)((UDATA)lhsObject + startOffset + offset), compressed);
-			fomrobject_t rhsValue = GC_SlotObject::readSlot((fomrobject_t*)((UDATA)rhsObject + startOffset + offset), compressed);
-			if (lhsValue != rhsValue) {
-				result = false;
-				break;
-			}
-			offset += referenceSize;
+		/* no instanceDescription bits needed on this path; a reference-free value is compared as one
+		 * block of whole slots, which the C library compares a vector at a time
+		 */
+		UDATA compareSize = ROUND_UP_TO_POWEROF2(limit, referenceSize);
+		if (0 != memcmp((void *)((UDATA)lhsObject + startOffset), (void *)((UDATA)rhsObject + startOffset), compareSize)) {
+			result = false;
 		}
 	}
 
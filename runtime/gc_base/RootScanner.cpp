@@ -828,33 +828,33 @@ MM_RootScanner::scanRememberedSet(MM_EnvironmentBase *env)
 
 #if defined(J9VM_OPT_JVMTI)
 /**
- * Scan the JVMTI tag tables for object references
+ * Scan the JVMTI tag tables for object references.
+ * Each environment's table is a separate work unit so that agents' tables can be
+ * scanned (and cleared) by different GC threads in parallel.
  */
 void
 MM_RootScanner::scanJVMTIObjectTagTables(MM_EnvironmentBase *env)
 {
-	if(_singleThread || J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
-		reportScanningStarted(RootScannerEntity_JVMTIObjectTagTables);
-
-		J9JVMTIData * jvmtiData = J9JVMTI_DATA_FROM_VM(static_cast<J9JavaVM*>(_omrVM->_language_vm));
-		J9JVMTIEnv * jvmtiEnv;
-		J9Object **slotPtr;
-		if (NULL != jvmtiData) {
-			/* TODO: When JVMTI is supported in RTSJ, this structure needs to be locked
-			 * when it is being scanned
-			 */
-			GC_JVMTIObjectTagTableListIterator objectTagTableList(jvmtiData->environments);
-			while(NULL != (jvmtiEnv = (J9JVMTIEnv *)objectTagTableList.nextSlot())) {
-				if (NULL != jvmtiEnv->objectTagTable) {
+	J9JVMTIData * jvmtiData = J9JVMTI_DATA_FROM_VM(static_cast<J9JavaVM*>(_omrVM->_language_vm));
+	J9JVMTIEnv * jvmtiEnv;
+	J9Object **slotPtr;
+	if (NULL != jvmtiData) {
+		/* TODO: When JVMTI is supported in RTSJ, this structure needs to be locked
+		 * when it is being scanned
+		 */
+		GC_JVMTIObjectTagTableListIterator objectTagTableList(jvmtiData->environments);
+		while(NULL != (jvmtiEnv = (J9JVMTIEnv *)objectTagTableList.nextSlot())) {
+			if (NULL != jvmtiEnv->objectTagTable) {
+				if(_singleThread || J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+					reportScanningStarted(RootScannerEntity_JVMTIObjectTagTables);
 					GC_JVMTIObjectTagTableIterator objectTagTableIterator(jvmtiEnv->objectTagTable);
 					while(NULL != (slotPtr = (J9Object **)objectTagTableIterator.nextSlot())) {
 						doJVMTIObjectTagSlot(slotPtr, &objectTagTableIterator);
 					}
+					reportScanningEnded(RootScannerEntity_JVMTIObjectTagTables);
 				}
 			}
 		}
-
-		reportScanningEnded(RootScannerEntity_JVMTIObjectTagTables);
 	}
 }
 #endif /* J9VM_OPT_JVMTI */
@@ -112,6 +112,7 @@ GC_CheckCycle::printHelp(J9PortLibrary *portLib)
 	j9tty_printf(PORTLIB, "  check\n");
 	j9tty_printf(PORTLIB, "  nocheck\n");
 	j9tty_printf(PORTLIB, "  maxErrors=X\n");
+	j9tty_printf(PORTLIB, "  regionsample=X\n");
 
 	j9tty_printf(PORTLIB, "  abort\n");
 	j9tty_printf(PORTLIB, "  noabort\n");
@@ -293,6 +294,13 @@ top:
 							continue;
 						}
 
+						if (try_scan(&scan_start, "regionsample=")) {
+							UDATA interval;
+							scan_udata(&scan_start, &interval);
+							_engine->setRegionSampleInterval(interval);
+							continue;
+						}
+
 						if (try_scan(&scan_start, "darkmatter")) {
 							miscFlags |= J9MODRON_GCCHK_MISC_DARKMATTER;
 							continue;
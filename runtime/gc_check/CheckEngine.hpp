@@ -76,6 +76,8 @@ private:
 	#define UNINITIALIZED_SIZE_FOR_OWNABLESYNCHRONIER ((UDATA)-1)
 	UDATA	_ownableSynchronizerObjectCountOnList; /**< the count of ownableSynchronizerObjects on the ownableSynchronizerLists, =UNINITIALIZED_SIZE_FOR_OWNABLESYNCHRONIER indicates that the count has not been calculated */
 	UDATA	_ownableSynchronizerObjectCountOnHeap; /**< the count of ownableSynchronizerObjects on the heap, =UNINITIALIZED_SIZE_FOR_OWNABLESYNCHRONIER indicates that the count has not been calculated */
+	UDATA _regionSampleInterval; /**< Only every Nth heap region is checked in a cycle (1 means every region) */
+	UDATA _regionSampleOffset; /**< Which region, modulo _regionSampleInterval, is checked first in the next cycle */
 	
 protected:
 
@@ -171,6 +173,24 @@ public:
 	 * @param count the maximum number of errors to report
 	 */
 	MMINLINE void setMaxErrorsToReport(UDATA count) { _reporter->setMaxErrorsToReport(count); };
+
+	/**
+	 * Check only every Nth heap region per cycle, starting one region further along each cycle,
+	 * so that the whole heap is covered every N cycles at a fraction of the per-cycle cost.
+	 * @param interval the sampling interval (0 and 1 both mean every region)
+	 */
+	MMINLINE void setRegionSampleInterval(UDATA interval) { _regionSampleInterval = (0 == interval) ? 1 : interval; };
+	MMINLINE UDATA getRegionSampleInterval() { return _regionSampleInterval; };
+
+	/**
+	 * @return the sampling offset to use for this cycle's heap walk, advancing it for the next cycle
+	 */
+	MMINLINE UDATA nextRegionSampleOffset()
+	{
+		UDATA offset = _regionSampleOffset;
+		_regionSampleOffset = (offset + 1) % _regionSampleInterval;
+		return offset;
+	};
 	
 	GC_CheckEngine(J9JavaVM *javaVM, GC_CheckReporter *reporter)
 		: MM_Base()
@@ -184,6 +204,8 @@ public:
 		, _lastHeapObject3()
 		, _ownableSynchronizerObjectCountOnList(UNINITIALIZED_SIZE_FOR_OWNABLESYNCHRONIER)
 		, _ownableSynchronizerObjectCountOnHeap(UNINITIALIZED_SIZE_FOR_OWNABLESYNCHRONIER)
+		, _regionSampleInterval(1)
+		, _regionSampleOffset(0)
 #if defined(J9VM_GC_MODRON_SCAVENGER)	
 		, _scavengerBackout(false)
 		, _rsOverflowState(false)
@@ -35,6 +35,9 @@ typedef struct ObjectIteratorCallbackUserData {
 	GC_CheckEngine* engine; /* Input */
 	J9PortLibrary* portLibrary; /* Input */
 	J9MM_IterateRegionDescriptor* regionDesc; /* Temp - used internally by iterator functions */
+	UDATA sampleInterval; /* Input - check only every Nth region */
+	UDATA sampleOffset; /* Input - index, modulo sampleInterval, of the regions to check */
+	UDATA regionCount; /* Temp - number of regions visited so far */
 } ObjectIteratorCallbackUserData;
 
 /**
@@ -72,7 +75,15 @@ GC_CheckObjectHeap::check()
 	userData.engine = _engine;
 	userData.portLibrary = _portLibrary;
 	userData.regionDesc = NULL;
+	userData.sampleInterval = _engine->getRegionSampleInterval();
+	userData.sampleOffset = _engine->nextRegionSampleOffset();
+	userData.regionCount = 0;
 	_javaVM->memoryManagerFunctions->j9mm_iterate_heaps(_javaVM, _portLibrary, 0, check_heapIteratorCallback, &userData);
+
+	if (1 < userData.sampleInterval) {
+		/* Only part of the heap was walked, so the ownable synchronizer count on the heap can't be compared with the lists */
+		_engine->clearCountsForOwnableSynchronizerObjects();
+	}
 }
 
 void
@@ -102,6 +113,12 @@ static jvmtiIterationControl
 check_regionIteratorCallback(J9JavaVM* vm, J9MM_IterateRegionDescriptor* regionDesc, void* userData)
 {
 	ObjectIteratorCallbackUserData* castUserData = (ObjectIteratorCallbackUserData*)userData;
+	UDATA regionIndex = castUserData->regionCount;
+	castUserData->regionCount += 1;
+	if (castUserData->sampleOffset != (regionIndex % castUserData->sampleInterval)) {
+		/* not sampled in this cycle */
+		return JVMTI_ITERATION_CONTINUE;
+	}
 	castUserData->regionDesc = regionDesc;
 	vm->memoryManagerFunctions->j9mm_iterate_region_objects(vm, castUserData->portLibrary, regionDesc, j9mm_iterator_flag_include_holes, check_objectIteratorCallback, castUserData);
 	return JVMTI_ITERATION_CONTINUE;
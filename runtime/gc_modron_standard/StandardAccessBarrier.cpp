@@ -611,6 +611,11 @@ MM_StandardAccessBarrier::getJNICriticalRegionCount(MM_GCExtensions *extensions)
 I_32
 MM_StandardAccessBarrier::doCopyContiguousBackwardWithReadBarrier(J9VMThread *vmThread, J9IndexableObject *srcObject, J9IndexableObject *destObject, I_32 srcIndex, I_32 destIndex, I_32 lengthInSlots)
 {
+	/* Only slots still referring to evacuate memory need the read barrier slow path, so filter them
+	 * here rather than paying the full preObjectRead() call for every slot of the range.
+	 */
+	MM_Scavenger *scavenger = _extensions->scavenger;
+
 	srcIndex += lengthInSlots;
 	destIndex += lengthInSlots;
 
@@ -620,7 +625,9 @@ MM_StandardAccessBarrier::doCopyContiguousBackwardWithReadBarrier(J9VMThread *vm
 		uint32_t *srcEndSlot = srcSlot - lengthInSlots;
 
 		while (srcSlot-- > srcEndSlot) {
-			preObjectRead(vmThread, (J9Object *)srcObject, (fj9object_t*)srcSlot);
+			if (scavenger->isObjectInEvacuateMemory(convertPointerFromToken((fomrobject_t)*(volatile uint32_t *)srcSlot))) {
+				preObjectRead(vmThread, (J9Object *)srcObject, (fj9object_t*)srcSlot);
+			}
 
 			*--destSlot = *srcSlot;
 		}
@@ -630,7 +637,9 @@ MM_StandardAccessBarrier::doCopyContiguousBackwardWithReadBarrier(J9VMThread *vm
 		uintptr_t *srcEndSlot = srcSlot - lengthInSlots;
 
 		while (srcSlot-- > srcEndSlot) {
-			preObjectRead(vmThread, (J9Object *)srcObject, (fj9object_t*)srcSlot);
+			if (scavenger->isObjectInEvacuateMemory(convertPointerFromToken((fomrobject_t)*(volatile uintptr_t *)srcSlot))) {
+				preObjectRead(vmThread, (J9Object *)srcObject, (fj9object_t*)srcSlot);
+			}
 
 			*--destSlot = *srcSlot;
 		}	
@@ -642,13 +651,17 @@ MM_StandardAccessBarrier::doCopyContiguousBackwardWithReadBarrier(J9VMThread *vm
 I_32
 MM_StandardAccessBarrier::doCopyContiguousForwardWithReadBarrier(J9VMThread *vmThread, J9IndexableObject *srcObject, J9IndexableObject *destObject, I_32 srcIndex, I_32 destIndex, I_32 lengthInSlots)
 {
+	MM_Scavenger *scavenger = _extensions->scavenger;
+
 	if (J9VMTHREAD_COMPRESS_OBJECT_REFERENCES(vmThread)) {
 		uint32_t *srcSlot = (uint32_t *)indexableEffectiveAddress(vmThread, srcObject, srcIndex, sizeof(uint32_t));
 		uint32_t *destSlot = (uint32_t *)indexableEffectiveAddress(vmThread, destObject, destIndex, sizeof(uint32_t));
 		uint32_t *srcEndSlot = srcSlot + lengthInSlots;
 
 		while (srcSlot < srcEndSlot) {
-			preObjectRead(vmThread, (J9Object *)srcObject, (fj9object_t*)srcSlot);
+			if (scavenger->isObjectInEvacuateMemory(convertPointerFromToken((fomrobject_t)*(volatile uint32_t *)srcSlot))) {
+				preObjectRead(vmThread, (J9Object *)srcObject, (fj9object_t*)srcSlot);
+			}
 	
 			*destSlot++ = *srcSlot++;
 		}
@@ -658,7 +671,9 @@ MM_StandardAccessBarrier::doCopyContiguousForwardWithReadBarrier(J9VMThread *vmT
 		uintptr_t *srcEndSlot = srcSlot + lengthInSlots;
 
 		while (srcSlot < srcEndSlot) {
-			preObjectRead(vmThread, (J9Object *)srcObject, (fj9object_t*)srcSlot);
+			if (scavenger->isObjectInEvacuateMemory(convertPointerFromToken((fomrobject_t)*(volatile uintptr_t *)srcSlot))) {
+				preObjectRead(vmThread, (J9Object *)srcObject, (fj9object_t*)srcSlot);
+			}
 	
 			*destSlot++ = *srcSlot++;
 		}
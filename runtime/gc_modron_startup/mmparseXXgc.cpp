@@ -320,6 +320,27 @@ gcParseXXgcArguments(J9JavaVM *vm, char *optArg)
 			continue;
 		}
 
+		if (try_scan(&scan_start, "tarokRememberedSetOverflowKickoffPercent=")) {
+			if(!scan_udata_helper(vm, &scan_start, &(extensions->tarokRememberedSetOverflowKickoffPercent), "tarokRememberedSetOverflowKickoffPercent=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			if (100 < extensions->tarokRememberedSetOverflowKickoffPercent) {
+				j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_INTEGER_OUT_OF_RANGE, "tarokRememberedSetOverflowKickoffPercent=", (UDATA)0, (UDATA)100);
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+
+		if (try_scan(&scan_start, "tarokTargetMaxPauseTime=")) {
+			if(!scan_udata_helper(vm, &scan_start, &(extensions->tarokTargetMaxPauseTimeMillis), "tarokTargetMaxPauseTime=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+
 		if (try_scan(&scan_start, "tarokKickoffHeadroomInBytes=")) {
 			if(!scan_udata_memory_size_helper(vm, &scan_start, &(extensions->tarokKickoffHeadroomInBytes), "tarokKickoffHeadroomInBytes=")) {
 				returnValue = JNI_EINVAL;
@@ -1170,6 +1191,13 @@ gcParseXXgcArguments(J9JavaVM *vm, char *optArg)
 			extensions->gcOnIdleCompactThreshold = ((float)percentage) / 100.0f;
 			continue;
 		}
+		if (try_scan(&scan_start, "gcOnIdleMinimumInterval=")) {
+			if(!scan_udata_helper(vm, &scan_start, &extensions->gcOnIdleMinimumIntervalMillis, "gcOnIdleMinimumInterval=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
 #endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
 
 #if defined (J9VM_GC_VLHGC)
@@ -143,6 +143,26 @@ j9gc_initialize_parse_gc_colon(J9JavaVM *javaVM, char **scan_start)
 		}		
 		goto _exit;
 	}
+	if (try_scan(scan_start, "targetUtilizationMin=")) {
+		if(!scan_udata_helper(javaVM, scan_start, &(extensions->targetUtilizationMinPercentage), "targetUtilizationMin=")) {
+			goto _error;
+		}
+		if ((extensions->targetUtilizationMinPercentage < 1) || (99 < extensions->targetUtilizationMinPercentage)) {
+			j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_INTEGER_OUT_OF_RANGE, "targetUtilizationMin=", (UDATA)1, (UDATA)99);
+			goto _error;
+		}
+		goto _exit;
+	}
+	if (try_scan(scan_start, "targetUtilizationMax=")) {
+		if(!scan_udata_helper(javaVM, scan_start, &(extensions->targetUtilizationMaxPercentage), "targetUtilizationMax=")) {
+			goto _error;
+		}
+		if ((extensions->targetUtilizationMaxPercentage < 1) || (99 < extensions->targetUtilizationMaxPercentage)) {
+			j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_INTEGER_OUT_OF_RANGE, "targetUtilizationMax=", (UDATA)1, (UDATA)99);
+			goto _error;
+		}
+		goto _exit;
+	}
 	if (try_scan(scan_start, "threads=")) {
 		if(!scan_udata_helper(javaVM, scan_start, &(extensions->gcThreadCount), "threads=")) {
 			goto _error;
@@ -29,6 +29,7 @@
 #include "AtomicOperations.hpp"
 #include "EnvironmentRealtime.hpp"
 #include "GCCode.hpp"
+#include "GCExtensions.hpp"
 #include "GCExtensionsBase.hpp"
 #include "Heap.hpp"
 #include "IncrementalParallelTask.hpp"
@@ -194,6 +195,18 @@ MM_Scheduler::initialize(MM_EnvironmentBase *env)
 		goto error_no_memory;
 	}
 
+	/* Adaptive utilization only applies when both bounds are given and bracket the static target */
+	{
+		MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(_extensions);
+		double minTargetUtilization = extensions->targetUtilizationMinPercentage / 1e2;
+		double maxTargetUtilization = extensions->targetUtilizationMaxPercentage / 1e2;
+		if ((0.0 < _staticTargetUtilization) && (0.0 < minTargetUtilization)
+			&& (minTargetUtilization <= _staticTargetUtilization) && (_staticTargetUtilization <= maxTargetUtilization)) {
+			_minTargetUtilization = minTargetUtilization;
+			_maxTargetUtilization = maxTargetUtilization;
+		}
+	}
+
 	
 	/* Set up the table used for keeping track of which threads were resumed from suspended */
 	_threadResumedTable = (bool*)env->getForge()->allocate(_threadCountMaximum * sizeof(bool), MM_AllocationCategory::FIXED, OMR_GET_CALLSITE());
@@ -480,6 +493,42 @@ MM_Scheduler::shouldMutatorDoubleBeat(MM_EnvironmentRealtime *env, MM_Timer *tim
 	return (excessBeats <= 1.0);
 }
 
+/**
+ * Vary the target utilization between the configured bounds according to the heap headroom left
+ * in the current cycle.  While most of the free memory above the trigger remains, the mutator gets
+ * the upper bound; as allocation consumes it the GC is given more of each window, down to the lower
+ * bound when the heap is nearly full.  The beat size is unaffected, so no GC quantum grows longer.
+ * Only the main thread calls this, at the start of each increment.
+ */
+void
+MM_Scheduler::adjustTargetUtilization(MM_EnvironmentRealtime *env)
+{
+	if (0.0 == _maxTargetUtilization) {
+		return;
+	}
+
+	uintptr_t bytesInUse = _gc->_memoryPool->getBytesInUse();
+	uintptr_t heapSize = _extensions->memoryMax;
+	uintptr_t headroomAtTrigger = (heapSize > _extensions->gcTrigger) ? (heapSize - _extensions->gcTrigger) : 0;
+	double headroomFraction = 0.0;
+	if ((0 != headroomAtTrigger) && (heapSize > bytesInUse)) {
+		headroomFraction = (double)(heapSize - bytesInUse) / (double)headroomAtTrigger;
+		if (headroomFraction > 1.0) {
+			headroomFraction = 1.0;
+		}
+	}
+
+	double previousTargetUtilization = _utilTracker->getTargetUtilization();
+	double targetUtilization = _minTargetUtilization + ((_maxTargetUtilization - _minTargetUtilization) * headroomFraction);
+	_utilTracker->setTargetUtilization(targetUtilization);
+
+	if ((verbose() >= 2) && ((I_32)(previousTargetUtilization * 1e2) != (I_32)(targetUtilization * 1e2))) {
+		OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+		omrtty_printf("Target utilization changed from %4.1f%% to %4.1f%% (%zu Mb in use)\n",
+			previousTargetUtilization * 1e2, targetUtilization * 1e2, bytesInUse >> 20);
+	}
+}
+
 void
 MM_Scheduler::reportStartGCIncrement(MM_EnvironmentRealtime *env)
 {
@@ -521,6 +570,7 @@ MM_Scheduler::reportStartGCIncrement(MM_EnvironmentRealtime *env)
 	TRIGGER_J9HOOK_MM_PRIVATE_METRONOME_INCREMENT_START(_extensions->privateHookInterface, env->getOmrVMThread(), omrtime_hires_clock(), J9HOOK_MM_PRIVATE_METRONOME_INCREMENT_START, _extensions->globalGCStats.metronomeStats._microsToStopMutators);
 
 	_currentConsecutiveBeats = 1;
+	adjustTargetUtilization(env);
 	startGCTime(env, false);
 
 	_gc->flushCachesForGC(env);
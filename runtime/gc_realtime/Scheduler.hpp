@@ -127,6 +127,8 @@ public:
 	double beat;
 	U_64 beatNanos;
 	double _staticTargetUtilization;
+	double _minTargetUtilization; /**< Lower bound for the adaptive target utilization (0 when adaptation is disabled) */
+	double _maxTargetUtilization; /**< Upper bound for the adaptive target utilization (0 when adaptation is disabled) */
 
 	MM_UtilizationTracker* _utilTracker;
 
@@ -207,6 +209,7 @@ public:
 	bool isGCOn();
 	bool shouldGCDoubleBeat(MM_EnvironmentRealtime *env);
 	bool shouldMutatorDoubleBeat(MM_EnvironmentRealtime *env, MM_Timer *timer);
+	void adjustTargetUtilization(MM_EnvironmentRealtime *env);
 	void reportStartGCIncrement(MM_EnvironmentRealtime *env);
 	void reportStopGCIncrement(MM_EnvironmentRealtime *env, bool isCycleEnd = false);
 	void restartMutatorsAndWait(MM_EnvironmentRealtime *env);
@@ -271,6 +274,8 @@ public:
 		beat(),
 		beatNanos(),
 		_staticTargetUtilization(),
+		_minTargetUtilization(0.0),
+		_maxTargetUtilization(0.0),
 		_utilTracker(NULL)
 	{
 		_typeId = __FUNCTION__;
@@ -95,6 +95,17 @@ MM_UtilizationTracker::getTargetUtilization()
 	return _targetUtilization;
 }
 
+/**
+ * Replace the utilization target.  The new target takes effect on the next call to addTimeSlice.
+ *
+ * @note Synchronization must be provided externally when calling this method.
+ */
+void
+MM_UtilizationTracker::setTargetUtilization(double targetUtil)
+{
+	_targetUtilization = targetUtil;
+}
+
 /**
  * Compacts the timeSlice array to two entries (1 for mutator, 1 for GC) since the
  * array will overflow on the next call to addTimeSlice if we do not.
@@ -20,6 +20,7 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
  *******************************************************************************/
 
+#include "j9.h"
 #include "j9modron.h"
 #include "modronbase.h"
 #include "omrgcconsts.h"
@@ -41,6 +42,7 @@
 static void verboseHandlerClassUnloadingEnd(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
 #endif /* defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING) */
 static void verboseHandlerSlowExclusive(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData);
+static UDATA slowExclusiveTopFrameIterator(J9VMThread *currentThread, J9StackWalkState *walkState);
 
 MM_VerboseHandlerOutput *
 MM_VerboseHandlerOutputStandardJava::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager)
@@ -182,8 +184,32 @@ MM_VerboseHandlerOutputStandardJava::handleSlowExclusive(J9HookInterface **hook,
 	char threadName[64];
 	getThreadName(threadName,sizeof(threadName),event->currentThread->omrVMThread);
 
+	/* The reporting thread is the last responder, so its top frame is where it was running when the request was made */
+	J9StackWalkState walkState;
+	walkState.walkThread = event->currentThread;
+	walkState.flags = J9_STACKWALK_ITERATE_FRAMES | J9_STACKWALK_VISIBLE_ONLY | J9_STACKWALK_INCLUDE_NATIVES;
+	walkState.skipCount = 0;
+	walkState.frameWalkFunction = slowExclusiveTopFrameIterator;
+	walkState.userData1 = NULL;
+	walkState.userData2 = NULL;
+	event->currentThread->javaVM->walkStackFrames(event->currentThread, &walkState);
+
 	enterAtomicReportingBlock();
-	writer->formatAndOutput(env, 0,"<warning details=\"slow exclusive request due to %s\" threadname=\"%s\" timems=\"%zu\" />", (event->reason == 1)?"JNICritical":"Exclusive Access", threadName, event->timeTaken);
+	J9Method *method = (J9Method *)walkState.userData1;
+	if (NULL != method) {
+		J9UTF8 *className = J9ROMCLASS_CLASSNAME(J9_CLASS_FROM_METHOD(method)->romClass);
+		J9ROMMethod *romMethod = J9_ROM_METHOD_FROM_RAM_METHOD(method);
+		J9UTF8 *methodName = J9ROMMETHOD_NAME(romMethod);
+		J9UTF8 *methodSignature = J9ROMMETHOD_SIGNATURE(romMethod);
+		writer->formatAndOutput(env, 0,"<warning details=\"slow exclusive request due to %s\" threadname=\"%s\" timems=\"%zu\" method=\"%.*s.%.*s%.*s\" jit=\"%s\" />",
+				(event->reason == 1)?"JNICritical":"Exclusive Access", threadName, event->timeTaken,
+				(U_32)J9UTF8_LENGTH(className), J9UTF8_DATA(className),
+				(U_32)J9UTF8_LENGTH(methodName), J9UTF8_DATA(methodName),
+				(U_32)J9UTF8_LENGTH(methodSignature), J9UTF8_DATA(methodSignature),
+				(NULL != walkState.userData2) ? "true" : "false");
+	} else {
+		writer->formatAndOutput(env, 0,"<warning details=\"slow exclusive request due to %s\" threadname=\"%s\" timems=\"%zu\" />", (event->reason == 1)?"JNICritical":"Exclusive Access", threadName, event->timeTaken);
+	}
 	writer->flush(env);
 	exitAtomicReportingBlock();
 
@@ -329,3 +355,17 @@ verboseHandlerSlowExclusive(J9HookInterface **hook, UDATA eventNum, void *eventD
 {
 	((MM_VerboseHandlerOutputStandardJava *)userData)->handleSlowExclusive(hook, eventNum, eventData);
 }
+
+/**
+ * Stack walk callback which records the method of the first visible frame in userData1,
+ * and whether that frame is compiled in userData2.
+ */
+static UDATA
+slowExclusiveTopFrameIterator(J9VMThread *currentThread, J9StackWalkState *walkState)
+{
+	walkState->userData1 = walkState->method;
+#if defined(J9VM_INTERP_NATIVE_SUPPORT)
+	walkState->userData2 = walkState->jitInfo;
+#endif /* defined(J9VM_INTERP_NATIVE_SUPPORT) */
+	return J9_STACKWALK_STOP_ITERATING;
+}
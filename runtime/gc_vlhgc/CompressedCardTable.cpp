@@ -31,6 +31,7 @@
 #include "j9modron.h"
 #include "ModronAssertions.h"
 
+#include "Bits.hpp"
 #include "CardCleaner.hpp"
 #include "CardTable.hpp"
 #include "CompressedCardTable.hpp"
@@ -284,28 +285,33 @@ MM_CompressedCardTable::cleanCardsInRange(MM_EnvironmentBase *env, MM_CardCleane
 	for (UDATA i = compressedCardStartIndex; i < compressedCardEndIndex; i++) {
 		UDATA compressedCardWord = _compressedCardTable[i];
 		if (AllCompressedCardsInWordClean != compressedCardWord) {
-			/* search for dirty cards - iterate bits */
-			for (UDATA j = 0; j < COMPRESSED_CARDS_PER_WORD; j++) {
-				if (CompressedCardDirty == (compressedCardWord & 1)) {
-					for (UDATA k = 0; k < COMPRESSED_CARD_TABLE_DIV; k++) {
-						/* clean card */
-						cardCleaner->clean(env, address, address + CARD_SIZE, card);
-						card += 1;
-						address += CARD_SIZE;
-						cardsCleaned += 1;
-					}
-				} else {
-					/* skip cards this bit responsible for */
-					card += COMPRESSED_CARD_TABLE_DIV;
-					address += (CARD_SIZE * COMPRESSED_CARD_TABLE_DIV);
+			/* search for dirty cards - jump straight from one dirty bit to the next rather than testing every bit,
+			 * since dirty cards are typically sparse within a word
+			 */
+#if defined(COMPRESSED_CARD_TABLE_INVERTED)
+			UDATA dirtyBits = ~compressedCardWord;
+#else /* defined(COMPRESSED_CARD_TABLE_INVERTED) */
+			UDATA dirtyBits = compressedCardWord;
+#endif /* defined(COMPRESSED_CARD_TABLE_INVERTED) */
+			while (0 != dirtyBits) {
+				/* MM_Bits::leadingZeroes() counts from the low order bit, so this is the index of the next dirty bit */
+				UDATA j = MM_Bits::leadingZeroes(dirtyBits);
+				dirtyBits &= ~((UDATA)1 << j);
+
+				Card *dirtyCard = card + (j * COMPRESSED_CARD_TABLE_DIV);
+				U_8 *dirtyAddress = address + (j * CARD_SIZE * COMPRESSED_CARD_TABLE_DIV);
+				for (UDATA k = 0; k < COMPRESSED_CARD_TABLE_DIV; k++) {
+					/* clean card */
+					cardCleaner->clean(env, dirtyAddress, dirtyAddress + CARD_SIZE, dirtyCard);
+					dirtyCard += 1;
+					dirtyAddress += CARD_SIZE;
+					cardsCleaned += 1;
 				}
-				compressedCardWord >>= 1;
 			}
-		} else {
-			/* skip cards this word responsible for */
-			card += (COMPRESSED_CARD_TABLE_DIV * COMPRESSED_CARDS_PER_WORD);
-			address += (CARD_SIZE * COMPRESSED_CARD_TABLE_DIV * COMPRESSED_CARDS_PER_WORD);
 		}
+		/* advance over the cards this word is responsible for */
+		card += (COMPRESSED_CARD_TABLE_DIV * COMPRESSED_CARDS_PER_WORD);
+		address += (CARD_SIZE * COMPRESSED_CARD_TABLE_DIV * COMPRESSED_CARDS_PER_WORD);
 	}
 
 	env->_cardCleaningStats._cardsCleaned += cardsCleaned;
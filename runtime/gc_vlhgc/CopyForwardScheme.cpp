@@ -2750,13 +2750,18 @@ MM_CopyForwardScheme::getNextWorkUnitNoWait(MM_EnvironmentVLHGC *env, UDATA pref
 			/* try the common node */
 			ret = getNextWorkUnitOnNode(env, COMMON_CONTEXT_INDEX);
 		}
-		/* now try the remaining nodes */
-		UDATA nextNode = (preferredNumaNode + 1) % nodeLists;
-		while ((SCAN_REASON_NONE == ret) && (nextNode != preferredNumaNode)) {
-			if (COMMON_CONTEXT_INDEX != nextNode) {
-				ret = getNextWorkUnitOnNode(env, nextNode);
-			}
-			nextNode = (nextNode + 1) % nodeLists;
+		if (SCAN_REASON_NONE == ret) {
+			/* now try the remaining nodes. Start at a worker-dependent node so that the threads of a node which ran out
+			 * of local work spread over the remote lists rather than all contending on the same neighbouring one.
+			 */
+			UDATA startNode = (preferredNumaNode + 1 + (env->getWorkerID() % nodeLists)) % nodeLists;
+			UDATA nextNode = startNode;
+			do {
+				if ((COMMON_CONTEXT_INDEX != nextNode) && (preferredNumaNode != nextNode)) {
+					ret = getNextWorkUnitOnNode(env, nextNode);
+				}
+				nextNode = (nextNode + 1) % nodeLists;
+			} while ((SCAN_REASON_NONE == ret) && (nextNode != startNode));
 		}
 	}
 	if (SCAN_REASON_NONE == ret && (0 != _regionCountCannotBeEvacuated) && !abortFlagRaised()) {
@@ -48,6 +48,13 @@ MM_CopyScanCacheListVLHGC::initialize(MM_EnvironmentVLHGC *env)
 {
 	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(env);
 	_sublistCount = extensions->packetListSplit;
+	/* Threads push to and pop from their own sublist first and only visit the others when it is empty. With one
+	 * sublist per GC thread the common path never shares a lock, which matters with many GC threads since the
+	 * packet list split grows much slower than the thread count.
+	 */
+	if (_sublistCount < extensions->gcThreadCount) {
+		_sublistCount = extensions->gcThreadCount;
+	}
 	Assert_MM_true(0 < _sublistCount);
 	
 	UDATA sublistBytes = sizeof(CopyScanCacheSublist) * _sublistCount;
@@ -261,6 +261,11 @@ public:
 	 */
 	void resetOverflowedList();
 
+	/**
+	 * @return the number of regions whose RSCL overflowed as full (not counting stable regions) and are waiting to be rebuilt by the next GMP
+	 */
+	MMINLINE UDATA getOverflowedRegionCount() const { return _overflowedRegionCount; }
+
 	/**
 	 * Copy internal stats counters into external structure used for Verbose GC reporting
 	 * @param env[in] of a GC thread
@@ -88,15 +88,21 @@ public:
 
 		if (0 != offset) {
 			/* there is room in the current buffer
-			 * simple optimization to avoid duplicates: check if this card is same as the last stored card
-			 * (at this point we know current is no NULL)
+			 * simple optimization to avoid duplicates: check if this card is same as one of the last two stored cards
+			 * (at this point we know current is no NULL). Looking two back also catches references into this region
+			 * being found alternately from two source cards (e.g. a structure whose nodes are interleaved over two cards),
+			 * which would otherwise fill buffers of popular regions with repeats and overflow them sooner.
 			 */
 			bool const compressed = env->compressObjectReferences();
 			MM_RememberedSetCard *cardAddress = MM_RememberedSetCard::subtractFromCardAddress(current, 1, compressed);
 			if (card != MM_RememberedSetCard::readCard(cardAddress, compressed)) {
-				/* no, not same, add it */
-				_current = MM_RememberedSetCard::addToCardAddress(current, 1, compressed);
-				MM_RememberedSetCard::writeCard(current, card, compressed);
+				if ((offset < (2 * MM_RememberedSetCard::cardSize(compressed)))
+					|| (card != MM_RememberedSetCard::readCard(MM_RememberedSetCard::subtractFromCardAddress(current, 2, compressed), compressed))
+				) {
+					/* no, not same, add it */
+					_current = MM_RememberedSetCard::addToCardAddress(current, 1, compressed);
+					MM_RememberedSetCard::writeCard(current, card, compressed);
+				}
 			}
 		} else {
 			addToNewBuffer(env, card);
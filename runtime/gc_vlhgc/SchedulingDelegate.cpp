@@ -45,6 +45,7 @@
 #include "HeapRegionIteratorVLHGC.hpp"
 #include "HeapRegionManager.hpp"
 #include "IncrementalGenerationalGC.hpp"
+#include "InterRegionRememberedSet.hpp"
 #include "MemoryPoolBumpPointer.hpp"
 
 /* NOTE: old logic for determining incremental thresholds has been deleted. Please 
@@ -966,6 +967,17 @@ MM_SchedulingDelegate::calculateAutomaticGMPIntermission(MM_EnvironmentVLHGC *en
 			UDATA globalMarkIncrementsRequiredWithHeadroom = globalMarkIncrementsRequired + incrementHeadroom;
 			UDATA globalMarkIncrementsRemaining = partialCollectsRemaining * _extensions->tarokPGCtoGMPDenominator / _extensions->tarokPGCtoGMPNumerator;
 			_remainingGMPIntermissionIntervals = MM_Math::saturatingSubtract(globalMarkIncrementsRemaining, globalMarkIncrementsRequiredWithHeadroom);
+
+			/* Overflowed RSCLs are only rebuilt by a GMP, and until then those regions have to be handled conservatively by every PGC.
+			 * If a significant part of the heap has overflowed, kick off the GMP now rather than waiting out the intermission.
+			 */
+			UDATA overflowKickoffPercent = _extensions->tarokRememberedSetOverflowKickoffPercent;
+			if ((0 < overflowKickoffPercent) && (0 < _remainingGMPIntermissionIntervals)) {
+				UDATA overflowedRegionCount = _extensions->interRegionRememberedSet->getOverflowedRegionCount();
+				if ((overflowedRegionCount * 100) >= (_regionManager->getTableRegionCount() * overflowKickoffPercent)) {
+					_remainingGMPIntermissionIntervals = 0;
+				}
+			}
 		}
 	}
 
@@ -998,6 +1010,15 @@ MM_SchedulingDelegate::calculateEdenSize(MM_EnvironmentVLHGC *env)
 	Assert_MM_true(edenMaximumCount >= 1);
 	Assert_MM_true(edenMaximumCount >= edenMinimumCount);
 	
+	/* With a pause time goal, cap the eden using the observed PGC time per eden region of the previous eden size.
+	 * Copy and remembered set scan work in a PGC both grow roughly linearly with the eden size.
+	 */
+	UDATA targetPauseTimeMillis = _extensions->tarokTargetMaxPauseTimeMillis;
+	if ((0 < targetPauseTimeMillis) && (0 < _historicalPartialGCTime) && (0 < _edenRegionCount)) {
+		UDATA edenCountForPauseTarget = (UDATA)(((double)targetPauseTimeMillis * (double)_edenRegionCount) / (double)_historicalPartialGCTime);
+		edenMaximumCount = OMR_MAX(edenMinimumCount, OMR_MIN(edenMaximumCount, edenCountForPauseTarget));
+	}
+
 	UDATA desiredEdenCount = freeRegions;
 	if (desiredEdenCount > edenMaximumCount) {
 		desiredEdenCount = edenMaximumCount;
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1998, 2016 IBM Corp. and others
+ * Copyright (c) 1998, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -63,3 +63,41 @@ Java_com_ibm_java_lang_management_internal_CompilationMXBeanImpl_isJITEnabled(JN
 
 	return JNI_FALSE;
 }
+
+jstring JNICALL
+Java_com_ibm_lang_management_internal_ExtendedCompilationMXBeanImpl_getCompilationPhaseStatisticsImpl(JNIEnv *env, jobject beanInstance)
+{
+	jstring result = NULL;
+#if defined (J9VM_INTERP_NATIVE_SUPPORT)
+	J9JavaVM *javaVM = ((J9VMThread *) env)->javaVM;
+	J9JITConfig *jitConfig = javaVM->jitConfig;
+
+	if ((NULL != jitConfig) && (NULL != jitConfig->printCompilationPhaseStatistics)) {
+		PORT_ACCESS_FROM_JAVAVM(javaVM);
+		UDATA bufferSize = 16 * 1024;
+
+		/* The statistics may grow between the two calls; retry until the report fits */
+		for (;;) {
+			UDATA length = 0;
+			char *buffer = j9mem_allocate_memory(bufferSize, J9MEM_CATEGORY_VM_JCL);
+
+			if (NULL == buffer) {
+				javaVM->internalVMFunctions->throwNativeOOMError(env, 0, 0);
+				break;
+			}
+			length = jitConfig->printCompilationPhaseStatistics(jitConfig, buffer, bufferSize);
+			if (length < bufferSize) {
+				if (0 != length) {
+					result = (*env)->NewStringUTF(env, buffer);
+				}
+				j9mem_free_memory(buffer);
+				break;
+			}
+			j9mem_free_memory(buffer);
+			bufferSize = length + 1024;
+		}
+	}
+#endif
+
+	return result;
+}
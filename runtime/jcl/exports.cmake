@@ -34,6 +34,7 @@ omr_add_exports(jclse
 	Java_com_ibm_java_lang_management_internal_CompilationMXBeanImpl_getTotalCompilationTimeImpl
 	Java_com_ibm_java_lang_management_internal_CompilationMXBeanImpl_isCompilationTimeMonitoringSupportedImpl
 	Java_com_ibm_java_lang_management_internal_CompilationMXBeanImpl_isJITEnabled
+	Java_com_ibm_lang_management_internal_ExtendedCompilationMXBeanImpl_getCompilationPhaseStatisticsImpl
 	Java_com_ibm_java_lang_management_internal_GarbageCollectorMXBeanImpl_getCollectionCountImpl
 	Java_com_ibm_java_lang_management_internal_GarbageCollectorMXBeanImpl_getCollectionTimeImpl
 	Java_com_ibm_java_lang_management_internal_GarbageCollectorMXBeanImpl_getLastCollectionEndTimeImpl
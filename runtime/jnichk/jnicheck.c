@@ -80,11 +80,13 @@ static IDATA jniCheckProcessCommandLine(J9JavaVM* javaVM, J9VMDllLoadInfo* loadI
 static UDATA globrefHashTableHashFn(void *entry, void *userData);
 static UDATA globrefHashTableEqualFn(void *leftEntry, void *rightEntry, void *userData);
 static void jniCheckJClassSubclass(JNIEnv* env, const char* function, IDATA argNum, jclass aJclass, J9Class* expectedSupclass, const char* expectedType);
+static BOOLEAN jniCheckLiteSkipArgs(J9JavaVM* vm, JNIEnv* env, BOOLEAN newCall);
 
 static UDATA keyInitCount = 0;
 omrthread_tls_key_t jniEntryCountKey;
 
 static omrthread_tls_key_t potentialPendingExceptionKey;
+static omrthread_tls_key_t liteCallCountKey;
 
 #define LOAD_LIB_WITH_PATH_CLASS "java/lang/ClassLoader"
 #define LOAD_LIB_WITH_PATH_METHOD "loadLibraryWithPath"
@@ -118,6 +120,9 @@ J9VMDllMain(J9JavaVM* vm, IDATA stage, void* reserved)
 			if (omrthread_tls_alloc(&potentialPendingExceptionKey)) {
 				return J9VMDLLMAIN_FAILED;
 			}
+			if (omrthread_tls_alloc(&liteCallCountKey)) {
+				return J9VMDLLMAIN_FAILED;
+			}
 
 			if (jniCheckMemoryInit(vm)) {
 				return J9VMDLLMAIN_FAILED;
@@ -328,18 +333,36 @@ jniCheckParseOptions(J9JavaVM* vm, char* options)
 			continue;
 		}
 
-		/* scan for levels */
+		/* scan for lite, optionally followed by the argument check sample interval */
+		if (try_scan(&scan_start, "lite=")) {
+			UDATA interval = 0;
+			if ((0 != scan_udata(&scan_start, &interval)) || (0 == interval)) {
+				j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_JNICHK_UNRECOGNIZED_OPTION, scan_start);
+				printJnichkHelp(PORTLIB);
+				return J9VMDLLMAIN_FAILED;
+			}
+			vm->checkJNIData.options |= JNICHK_LITE;
+			vm->checkJNIData.liteSampleInterval = interval;
+			continue;
+		}
+		if (try_scan(&scan_start, "lite")) {
+			vm->checkJNIData.options |= JNICHK_LITE;
+			vm->checkJNIData.liteSampleInterval = JNICHK_LITE_DEFAULT_SAMPLE_INTERVAL;
+			continue;
+		}
+
+		/* scan for levels; they replace the other options, but not lite, which is independent of the level */
 		if (try_scan(&scan_start, "level=low")) {
-			vm->checkJNIData.options = (JNICHK_NONFATAL | JNICHK_NOWARN | JNICHK_NOADVICE);
+			vm->checkJNIData.options = (vm->checkJNIData.options & JNICHK_LITE) | JNICHK_NONFATAL | JNICHK_NOWARN | JNICHK_NOADVICE;
 			continue;
 		} else if (try_scan(&scan_start, "level=medium")) {
-			vm->checkJNIData.options = (JNICHK_NONFATAL | JNICHK_NOWARN);
+			vm->checkJNIData.options = (vm->checkJNIData.options & JNICHK_LITE) | JNICHK_NONFATAL | JNICHK_NOWARN;
 			continue;
 		} else if (try_scan(&scan_start, "level=high")) {
-			vm->checkJNIData.options = 0;
+			vm->checkJNIData.options &= JNICHK_LITE;
 			continue;
 		} else if (try_scan(&scan_start, "level=maximum")) {
-			vm->checkJNIData.options = (JNICHK_INCLUDEBOOT | JNICHK_PEDANTIC);
+			vm->checkJNIData.options = (vm->checkJNIData.options & JNICHK_LITE) | JNICHK_INCLUDEBOOT | JNICHK_PEDANTIC;
 			continue;
 		}
 
@@ -452,6 +475,10 @@ jniCheckCallV(const char* function, JNIEnv* env, jobject receiver, UDATA methodT
 
 	jniCheckCall(function, env, receiver, methodType, returnType, method);
 
+	if (!trace && jniCheckLiteSkipArgs(vm, env, FALSE)) {
+		return;
+	}
+
 	if (!novalist) {
 		if (*((U_32 *) VA_PTR(originalArgs)) == BAD_VA_LIST) {
 			jniCheckFatalErrorNLS(env, J9NLS_JNICHK_VA_LIST_REUSE, function);
@@ -511,6 +538,10 @@ jniCheckCallA(const char* function, JNIEnv* env, jobject receiver, UDATA methodT
 
 	jniCheckCall(function, env, receiver, methodType, returnType, method);
 
+	if (!trace && jniCheckLiteSkipArgs(vm, env, FALSE)) {
+		return;
+	}
+
 	if (trace) {
 		UDATA indent = (UDATA) omrthread_tls_get(((J9VMThread *) env)->osThread, jniEntryCountKey);
 
@@ -597,6 +628,11 @@ jniCheckArgs(const char *function, int exceptionSafe, int criticalSafe, J9JniChe
 
 	fillInLocalRefTracking(env, refTracking);
 
+	/* In lite mode, the checks above are all that is done on most calls */
+	if (!trace && jniCheckLiteSkipArgs(vm, env, TRUE)) {
+		return;
+	}
+
 	if (trace) {
 		UDATA indent = (UDATA) omrthread_tls_get(((J9VMThread *) env)->osThread, jniEntryCountKey);
 
@@ -985,6 +1021,37 @@ jniCheckArgs(const char *function, int exceptionSafe, int criticalSafe, J9JniChe
 }
 
 
+/**
+ * In lite mode, decide whether the per-argument checks are skipped for this call.
+ * Only one call in every liteSampleInterval made by a thread has its arguments checked.
+ * The call counter is kept in thread local storage, so the decision made by jniCheckArgs()
+ * for a call is not affected by the JNI calls of other threads.
+ *
+ * @param[in] vm the J9JavaVM
+ * @param[in] env the JNIEnv of the current thread
+ * @param[in] newCall TRUE when called from jniCheckArgs() at the start of a JNI call,
+ * FALSE to repeat the decision already made for the current call (jniCheckCallV/A)
+ * @return TRUE if the argument checks should be skipped, FALSE otherwise
+ */
+static BOOLEAN
+jniCheckLiteSkipArgs(J9JavaVM* vm, JNIEnv* env, BOOLEAN newCall)
+{
+	omrthread_t osThread = ((J9VMThread *) env)->osThread;
+	UDATA callCount = 0;
+
+	if (J9_ARE_NO_BITS_SET(vm->checkJNIData.options, JNICHK_LITE)) {
+		return FALSE;
+	}
+	callCount = (UDATA) omrthread_tls_get(osThread, liteCallCountKey);
+	if (newCall) {
+		omrthread_tls_set(osThread, liteCallCountKey, (void*) (callCount + 1));
+	} else {
+		callCount -= 1;
+	}
+	return 0 != (callCount % vm->checkJNIData.liteSampleInterval);
+}
+
+
 static J9Class*
 jnichk_getObjectClazz(JNIEnv* env, jobject objRef)
 {
@@ -1089,6 +1156,7 @@ static void printJnichkHelp(J9PortLibrary* portLib) {
 	j9file_printf(PORTLIB, J9PORT_TTY_OUT, j9nls_lookup_message(J9NLS_DO_NOT_PRINT_MESSAGE_TAG, J9NLS_JNICHK_HELP_11, NULL));
 	j9file_printf(PORTLIB, J9PORT_TTY_OUT, j9nls_lookup_message(J9NLS_DO_NOT_PRINT_MESSAGE_TAG, J9NLS_JNICHK_HELP_12, NULL));
 	j9file_printf(PORTLIB, J9PORT_TTY_OUT, j9nls_lookup_message(J9NLS_DO_NOT_PRINT_MESSAGE_TAG, J9NLS_JNICHK_HELP_16, NULL));
+	j9file_printf(PORTLIB, J9PORT_TTY_OUT, j9nls_lookup_message(J9NLS_DO_NOT_PRINT_MESSAGE_TAG, J9NLS_JNICHK_HELP_17, NULL));
 	j9file_printf(PORTLIB, J9PORT_TTY_OUT, "\n");
 }
 
@@ -1113,6 +1113,9 @@ typedef struct J9SharedClassJavacoreDataDescriptor {
 	UDATA numObjects;
 	UDATA numStartupHints;
 	UDATA startupHintBytes;
+	UDATA numFindROMClass;
+	UDATA numFindROMClassHits;
+	UDATA numFindROMClassStale;
 } J9SharedClassJavacoreDataDescriptor;
 
 typedef struct J9SharedStringFarm {
@@ -1290,6 +1293,7 @@ typedef struct J9SharedClassConfig {
 	void  (*storeGCHints)(struct J9VMThread* currentThread, UDATA heapSize1, UDATA heapSize2, BOOLEAN forceReplace);
 	IDATA  (*findGCHints)(struct J9VMThread* currentThread, UDATA *heapSize1, UDATA *heapSize2);
 	void  ( *updateClasspathOpenState)(struct J9JavaVM* vm, struct J9ClassPathEntry* classPathEntries, UDATA entryIndex, UDATA entryCount, BOOLEAN isOpen);
+	UDATA  ( *getCacheCreateTimes)(struct J9JavaVM* vm, U_64* createTimes, UDATA maxLayers);
 	struct J9MemorySegment* metadataMemorySegment;
 	struct J9Pool* classnameFilterPool;
 	U_32 softMaxBytes;
@@ -1800,6 +1804,10 @@ typedef struct J9DynamicLoadStats {
 	UDATA sunSize;
 	UDATA romSize;
 	UDATA debugSize;
+	UDATA classCount;
+	U_64 totalReadTime;
+	U_64 totalLoadTime;
+	U_64 totalTranslateTime;
 } J9DynamicLoadStats;
 
 typedef struct J9JImageIntf {
@@ -3073,6 +3081,16 @@ typedef struct J9InitializerMethods {
 	struct J9Method* invokePrivateMethod;
 } J9InitializerMethods;
 
+#define J9_LOCALMAP_CACHE_SIZE 2048
+#define J9_LOCALMAP_CACHE_MAX_LOCALS 64
+
+typedef struct J9LocalMapCacheEntry {
+	volatile UDATA sequence;
+	struct J9ROMMethod* romMethod;
+	UDATA pc;
+	U_32 bits[J9_LOCALMAP_CACHE_MAX_LOCALS / 32];
+} J9LocalMapCacheEntry;
+
 typedef struct J9VMInterface {
 	struct VMInterfaceFunctions_* functions;
 	struct J9JavaVM* javaVM;
@@ -3082,6 +3100,7 @@ typedef struct J9VMInterface {
 typedef struct J9CheckJNIData {
 	UDATA options;
 	struct J9HashTable* jniGlobalRefHashTab;
+	UDATA liteSampleInterval;
 } J9CheckJNIData;
 
 typedef struct J9AttachContext {
@@ -4015,6 +4034,7 @@ typedef struct J9JITConfig {
 	U_8* (*codeCacheWarmAlloc)(void *codeCache);
 	U_8* (*codeCacheColdAlloc)(void *codeCache);
 	void ( *printAOTHeaderProcessorFeatures)(struct TR_AOTHeader * aotHeaderAddress, char * buff, const size_t BUFF_SIZE);
+	UDATA ( *printCompilationPhaseStatistics)(struct J9JITConfig *jitConfig, char *buffer, UDATA bufferSize);
 	struct OMRProcessorDesc targetProcessor;
 	struct OMRProcessorDesc relocatableTargetProcessor;
 #if defined(J9VM_OPT_JITSERVER)
@@ -5380,6 +5400,9 @@ typedef struct J9JavaVM {
 	U_8* mapMemoryResultsBuffer;
 	UDATA mapMemoryBufferSize;
 	omrthread_monitor_t mapMemoryBufferMutex;
+	struct J9LocalMapCacheEntry* localMapCache;
+	omrthread_monitor_t localMapCacheMutex;
+	volatile UDATA localMapCacheGeneration;
 	omrthread_monitor_t jclCacheMutex;
 	UDATA arrayletLeafSize;
 	UDATA arrayletLeafLogSize;
@@ -5436,6 +5459,7 @@ typedef struct J9JavaVM {
 	struct J9Pool *customSpinOptions;
 #endif /* J9VM_INTERP_CUSTOM_SPIN_OPTIONS */
 	UDATA romMethodSortThreshold;
+	UDATA maxStackTraceDepth;
 #if defined(J9VM_THR_ASYNC_NAME_UPDATE)
 	IDATA threadNameHandlerKey;
 #endif /* J9VM_THR_ASYNC_NAME_UPDATE */
@@ -322,6 +322,8 @@ extern J9_CFUNC jlong JNICALL
 Java_com_ibm_java_lang_management_internal_CompilationMXBeanImpl_getTotalCompilationTimeImpl (JNIEnv *env, jobject beanInstance);
 extern J9_CFUNC jboolean JNICALL
 Java_com_ibm_java_lang_management_internal_CompilationMXBeanImpl_isCompilationTimeMonitoringSupportedImpl (JNIEnv *env, jobject beanInstance);
+extern J9_CFUNC jstring JNICALL
+Java_com_ibm_lang_management_internal_ExtendedCompilationMXBeanImpl_getCompilationPhaseStatisticsImpl (JNIEnv *env, jobject beanInstance);
 
 /* BBjclNativesCommonPlainMulticastSocketImpl*/
 void JNICALL Java_java_net_PlainMulticastSocketImpl_createMulticastSocketImpl (
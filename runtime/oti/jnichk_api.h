@@ -52,6 +52,9 @@ extern "C" {
 #define JNICHK_INCLUDEBOOT 0x200
 #define JNICHK_ALWAYSCOPY 0x400
 #define JNICHK_ABORTONERROR 0x800
+#define JNICHK_LITE 0x1000
+
+#define JNICHK_LITE_DEFAULT_SAMPLE_INTERVAL 100
 
 #ifdef __cplusplus
 }
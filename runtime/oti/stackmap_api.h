@@ -132,6 +132,51 @@ j9localmap_LocalBitsForPC(J9PortLibrary * portLib, J9ROMClass * romClass, J9ROMM
 		void * userData, UDATA * (* getBuffer) (void * userData), void (* releaseBuffer) (void * userData));
 
 
+/* ---------------- localmapcache.c ---------------- */
+
+/**
+* @brief Allocate the VM-wide cache of interpreter local maps and hook class unloading to flush it.
+* A failure to allocate is not fatal: the cache stays disabled and every request is computed.
+* @param vm
+* @return void
+*/
+void
+j9localmap_InitializeCache(J9JavaVM * vm);
+
+
+/**
+* @brief Free the local map cache.
+* @param vm
+* @return void
+*/
+void
+j9localmap_FreeCache(J9JavaVM * vm);
+
+
+/**
+* @brief Discard every cached local map.
+* @param vm
+* @return void
+*/
+void
+j9localmap_FlushCache(J9JavaVM * vm);
+
+
+/**
+* @brief Compute the local map for pc using vm->localMapFunction, answering from the cache when possible.
+* Maps are cached only for methods with at most J9_LOCALMAP_CACHE_MAX_LOCALS args and temps.
+* @param vm
+* @param romClass
+* @param romMethod
+* @param pc
+* @param resultArrayBase
+* @param argTempCount
+* @return IDATA
+*/
+IDATA
+j9localmap_CachedLocalBitsForPC(J9JavaVM * vm, J9ROMClass * romClass, J9ROMMethod * romMethod, UDATA pc, U_32 * resultArrayBase, UDATA argTempCount);
+
+
 /* ---------------- debuglocalmap.c ---------------- */
 
 /**
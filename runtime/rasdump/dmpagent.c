@@ -1856,6 +1856,8 @@ printDumpSpec(struct J9JavaVM *vm, IDATA kind, IDATA verboseLevel)
 
 				if (strcmp(spec->name, "heap") == 0) {
 					j9tty_err_printf(PORTLIB, "\n  opts=PHD|CLASSIC\n");
+				} else if (strcmp(spec->name, "java") == 0) {
+					j9tty_err_printf(PORTLIB, "\n  opts=LITE\n");
 				} else if (strcmp(spec->name, "tool") == 0) {
 					j9tty_err_printf(PORTLIB, "\n  opts=WAIT<msec>|ASYNC\n");
 #ifdef J9ZOS390
@@ -478,7 +478,11 @@ JavaCoreDumpWriter::JavaCoreDumpWriter(
 	CALL_PROTECT(writeProcessorSection, _Error);
 	CALL_PROTECT(writeEnvironmentSection, _Error);
 	CALL_PROTECT(writeMemoryCountersSection, _Error);
-	CALL_PROTECT(writeMemorySection, _Error);
+	/* opts=LITE skips the memory segment and class loader walks, which dominate on large heaps */
+	bool liteDump = (NULL != _Agent->dumpOptions) && (NULL != strstr(_Agent->dumpOptions, "LITE"));
+	if (!liteDump) {
+		CALL_PROTECT(writeMemorySection, _Error);
+	}
 
 	/* The monitor section is crash prone as objects mutate under it.
 	 * Lock ordering imposed by the lock inflation path means that we have to get the monitorTableMutex ahead of the
@@ -524,7 +528,9 @@ JavaCoreDumpWriter::JavaCoreDumpWriter(
 #if defined(J9VM_OPT_SHARED_CLASSES)
 	CALL_PROTECT(writeSharedClassSection, _Error);
 #endif
-	CALL_PROTECT(writeClassSection, _Error);
+	if (!liteDump) {
+		CALL_PROTECT(writeClassSection, _Error);
+	}
 	CALL_PROTECT(writeTrailer, _Error);
 
 	/* Record the status of the operation */
@@ -3268,6 +3274,21 @@ JavaCoreDumpWriter::writeSharedClassSectionAllLayersStatsHelper(J9SharedClassJav
 			"\n2SCLTEXTPST            Percent Stale classes                     = "
 	);
 	_OutputStream.writeInteger(javacoreData->percStale, "%zu");
+
+	_OutputStream.writeCharacters(
+			"\n2SCLTEXTNFR            Number ROMClass finds                     = "
+	);
+	_OutputStream.writeInteger(javacoreData->numFindROMClass, "%zu");
+
+	_OutputStream.writeCharacters(
+			"\n2SCLTEXTNFH            Number ROMClass finds hit                 = "
+	);
+	_OutputStream.writeInteger(javacoreData->numFindROMClassHits, "%zu");
+
+	_OutputStream.writeCharacters(
+			"\n2SCLTEXTNFS            Number ROMClass finds stale               = "
+	);
+	_OutputStream.writeInteger(javacoreData->numFindROMClassStale, "%zu");
 	_OutputStream.writeCharacters("\n");
 }
 
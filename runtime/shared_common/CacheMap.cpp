@@ -286,6 +286,9 @@ SH_CacheMap::initialize(J9JavaVM* vm, J9SharedClassConfig* sharedClassConfig, Bl
 	_writeHashSavedMaxWaitMicros = 0;
 	_writeHashAverageTimeMicros = 0;
 	_writeHashContendedResetHash = 0;
+	_findROMClassCount = 0;
+	_findROMClassHitCount = 0;
+	_findROMClassStaleCount = 0;
 	_bytesRead = 0;
 	_isAssertEnabled = true;
 	_metadataReleased = false;
@@ -2680,6 +2683,13 @@ SH_CacheMap::findROMClass(J9VMThread* currentThread, const char* path, Classpath
 		}
 	}
 
+	_findROMClassCount += 1;
+	if (rc & LOCATE_ROMCLASS_RETURN_FOUND) {
+		_findROMClassHitCount += 1;
+	} else if (rc & (LOCATE_ROMCLASS_RETURN_DO_MARK_CPEI_STALE | LOCATE_ROMCLASS_RETURN_MARKED_ITEM_STALE)) {
+		_findROMClassStaleCount += 1;
+	}
+
 	/* If ClasspathEntryItem is stale, become a writer, lock the cache and do stale mark */
 	if (rc & LOCATE_ROMCLASS_RETURN_DO_MARK_CPEI_STALE) {
 		markStale(currentThread, locateResult.staleCPEI, false);
@@ -4155,6 +4165,32 @@ SH_CacheMap::getJavacoreData(J9JavaVM *vm, J9SharedClassJavacoreDataDescriptor*
 	return getJavacoreData(vm, descriptor, false);
 }
 
+/* THREADING: Can be called at any time by any thread. Does not obtain any locks.
+ *
+ * Get the creation time of each started layer of the cache. Unlike the cache unique ID, the
+ * creation time of a layer does not change as the layer fills up.
+ *
+ * @param[out] createTimes  Array receiving the creation times, top layer first
+ * @param[in] maxLayers  The number of entries in createTimes
+ *
+ * @return the number of creation times written to createTimes
+ * */
+UDATA
+SH_CacheMap::getCacheCreateTimes(U_64* createTimes, UDATA maxLayers)
+{
+	UDATA count = 0;
+	SH_CompositeCacheImpl* walk = _ccHead;
+
+	while ((NULL != walk) && (count < maxLayers)) {
+		if (walk->isStarted()) {
+			createTimes[count] = walk->getCreateTime();
+			count += 1;
+		}
+		walk = walk->getPrevious();
+	}
+	return count;
+}
+
 /* THREADING: Can be called at any time by any thread. Should not try to get any locks as it may be being
  * called as a result of a deadlock. The only locks obtained are by the managers when querying their hashtables. 
  * 
@@ -4320,6 +4356,9 @@ SH_CacheMap::getJavacoreData(J9JavaVM *vm, J9SharedClassJavacoreDataDescriptor*
 	} else {
 		descriptor->numROMClasses = descriptor->numStaleClasses = descriptor->percStale = 0;
 	}
+	descriptor->numFindROMClass = _findROMClassCount;
+	descriptor->numFindROMClassHits = _findROMClassHitCount;
+	descriptor->numFindROMClassStale = _findROMClassStaleCount;
 	
 	if (_cmm && (_cmm->getState() == MANAGER_STATE_STARTED)) {
 		_cmm->getNumItems(NULL, &nonstale, &stale);
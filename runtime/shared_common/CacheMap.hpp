@@ -161,6 +161,8 @@ public:
 	/* @see SharedCache.hpp */
 	virtual UDATA getJavacoreData(J9JavaVM *vm, J9SharedClassJavacoreDataDescriptor* descriptor);
 
+	UDATA getCacheCreateTimes(U_64* createTimes, UDATA maxLayers);
+
 	/* @see SharedCache.hpp */
 	virtual IDATA markStale(J9VMThread* currentThread, ClasspathEntryItem* cpei, bool hasWriteMutex);
 
@@ -316,6 +318,11 @@ private:
 	UDATA _writeHashContendedResetHash;
 	/* Also see U_64 _writeHashStartTime above */
 
+	/* Outcomes of findROMClass() in this JVM. Updated without atomics, so they are approximate under contention. */
+	UDATA _findROMClassCount;
+	UDATA _findROMClassHitCount;
+	UDATA _findROMClassStaleCount;
+
 	UDATA _verboseFlags;
 	UDATA _bytesRead;
 	U_32 _actualSize;
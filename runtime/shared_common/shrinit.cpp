@@ -3490,6 +3490,7 @@ j9shr_init(J9JavaVM *vm, UDATA loadFlags, UDATA* nonfatal)
 		config->findGCHints = j9shr_findGCHints;
 		config->storeGCHints = j9shr_storeGCHints;
 		config->updateClasspathOpenState = j9shr_updateClasspathOpenState;
+		config->getCacheCreateTimes = j9shr_getCacheCreateTimes;
 
 		config->sharedAPIObject = initializeSharedAPI(vm);
 		if (config->sharedAPIObject == NULL) {
@@ -5266,6 +5267,20 @@ j9shr_findGCHints(J9VMThread* currentThread, UDATA *heapSize1, UDATA *heapSize2)
 	return returnVal;
 }
 
+/**
+ * Get the creation time of each started layer of the shared classes cache
+ * @param[in] vm  The J9JavaVM
+ * @param[out] createTimes  Array receiving the creation times, top layer first
+ * @param[in] maxLayers  The number of entries in createTimes
+ *
+ * @return the number of creation times written to createTimes
+ */
+UDATA
+j9shr_getCacheCreateTimes(J9JavaVM* vm, U_64* createTimes, UDATA maxLayers)
+{
+	return ((SH_CacheMap*)(vm->sharedClassConfig->sharedClassCache))->getCacheCreateTimes(createTimes, maxLayers);
+}
+
 /**
  * Determine the directory to use for the cache file or control file(s)
  *
@@ -692,4 +692,6 @@ void
 installDebugLocalMapper(J9JavaVM * vm)
 {
 	vm->localMapFunction = j9localmap_DebugLocalBitsForPC;
+	/* Maps computed by the previous mapper must not be answered from the cache */
+	j9localmap_FlushCache(vm);
 }
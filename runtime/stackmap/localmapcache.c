@@ -0,0 +1,194 @@
+/*******************************************************************************
+ * Copyright (c) 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <string.h>
+#include "j9.h"
+#include "j9port.h"
+#include "omrthread.h"
+#include "omrutilbase.h"
+#include "stackmap_api.h"
+#include "vmhook_internal.h"
+
+/*
+ * A direct-mapped cache of interpreter local maps keyed by ROM method and PC.
+ * Computing a local map re-simulates the method's bytecodes, and the same frames are
+ * mapped again on every GC, so caching makes walking deep interpreted stacks cheap.
+ * A colliding entry simply replaces the previous one, which keeps memory bounded.
+ *
+ * Lookups run in parallel GC stack scanning and take no lock. Each entry has a sequence
+ * number that is odd while the entry is being written: a reader retries the computation
+ * if the number was odd or changed during its copy, and a writer claims the entry by
+ * making the number odd with a compare and swap, giving up if another thread got there
+ * first. The mutex only serializes flushes. A flush bumps the cache generation before
+ * clearing the entries, and a writer drops a map computed under an older generation.
+ */
+
+#define LOCALMAP_CACHE_INDEX(romMethod, pc) (((((UDATA)(romMethod)) >> 3) * 31 + (pc)) & (J9_LOCALMAP_CACHE_SIZE - 1))
+
+#if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
+/*
+ * Entries are keyed by ROM method address, which may be reused once the owning class
+ * has been unloaded, so discard the whole cache whenever classes are unloaded.
+ */
+static void
+localMapCacheHookClassesUnload(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
+{
+	j9localmap_FlushCache((J9JavaVM *) userData);
+}
+#endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
+
+void
+j9localmap_InitializeCache(J9JavaVM * vm)
+{
+	PORT_ACCESS_FROM_JAVAVM(vm);
+	UDATA const cacheSize = sizeof(J9LocalMapCacheEntry) * J9_LOCALMAP_CACHE_SIZE;
+	J9LocalMapCacheEntry *cache = NULL;
+
+	if (0 != omrthread_monitor_init_with_name(&vm->localMapCacheMutex, 0, "VM local map cache")) {
+		vm->localMapCacheMutex = NULL;
+		return;
+	}
+
+	cache = (J9LocalMapCacheEntry *) j9mem_allocate_memory(cacheSize, OMRMEM_CATEGORY_VM);
+	if (NULL == cache) {
+		goto failed;
+	}
+	memset(cache, 0, cacheSize);
+
+#if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
+	{
+		J9HookInterface **vmHooks = vm->internalVMFunctions->getVMHookInterface(vm);
+
+		if ((0 != (*vmHooks)->J9HookRegisterWithCallSite(vmHooks, J9HOOK_VM_CLASSES_UNLOAD, localMapCacheHookClassesUnload, OMR_GET_CALLSITE(), vm))
+		|| (0 != (*vmHooks)->J9HookRegisterWithCallSite(vmHooks, J9HOOK_VM_ANON_CLASSES_UNLOAD, localMapCacheHookClassesUnload, OMR_GET_CALLSITE(), vm))
+		) {
+			(*vmHooks)->J9HookUnregister(vmHooks, J9HOOK_VM_CLASSES_UNLOAD, localMapCacheHookClassesUnload, vm);
+			j9mem_free_memory(cache);
+			goto failed;
+		}
+	}
+#endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
+
+	vm->localMapCache = cache;
+	return;
+
+failed:
+	/* The cache is an optimization only: run without it */
+	omrthread_monitor_destroy(vm->localMapCacheMutex);
+	vm->localMapCacheMutex = NULL;
+}
+
+void
+j9localmap_FreeCache(J9JavaVM * vm)
+{
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	if (NULL != vm->localMapCache) {
+#if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
+		J9HookInterface **vmHooks = vm->internalVMFunctions->getVMHookInterface(vm);
+
+		(*vmHooks)->J9HookUnregister(vmHooks, J9HOOK_VM_CLASSES_UNLOAD, localMapCacheHookClassesUnload, vm);
+		(*vmHooks)->J9HookUnregister(vmHooks, J9HOOK_VM_ANON_CLASSES_UNLOAD, localMapCacheHookClassesUnload, vm);
+#endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
+		j9mem_free_memory(vm->localMapCache);
+		vm->localMapCache = NULL;
+	}
+	if (NULL != vm->localMapCacheMutex) {
+		omrthread_monitor_destroy(vm->localMapCacheMutex);
+		vm->localMapCacheMutex = NULL;
+	}
+}
+
+void
+j9localmap_FlushCache(J9JavaVM * vm)
+{
+	J9LocalMapCacheEntry *cache = vm->localMapCache;
+
+	if (NULL != cache) {
+		UDATA i = 0;
+
+		omrthread_monitor_enter(vm->localMapCacheMutex);
+		/* Writers that check the generation after this point will not store their map */
+		vm->localMapCacheGeneration += 1;
+		issueReadWriteBarrier();
+		for (i = 0; i < J9_LOCALMAP_CACHE_SIZE; i++) {
+			J9LocalMapCacheEntry *entry = &cache[i];
+
+			for (;;) {
+				UDATA sequence = entry->sequence;
+
+				/* Wait for a writer that read the previous generation to finish, then clear its entry */
+				if ((0 == (sequence & 1)) && (sequence == compareAndSwapUDATA((uintptr_t *)&entry->sequence, sequence, sequence + 1))) {
+					entry->romMethod = NULL;
+					entry->pc = 0;
+					issueWriteBarrier();
+					entry->sequence = sequence + 2;
+					break;
+				}
+				omrthread_yield();
+			}
+		}
+		omrthread_monitor_exit(vm->localMapCacheMutex);
+	}
+}
+
+IDATA
+j9localmap_CachedLocalBitsForPC(J9JavaVM * vm, J9ROMClass * romClass, J9ROMMethod * romMethod, UDATA pc, U_32 * resultArrayBase, UDATA argTempCount)
+{
+	PORT_ACCESS_FROM_JAVAVM(vm);
+	J9LocalMapCacheEntry *cache = vm->localMapCache;
+	IDATA rc = 0;
+
+	if ((NULL != cache) && (argTempCount <= J9_LOCALMAP_CACHE_MAX_LOCALS)) {
+		J9LocalMapCacheEntry *entry = &cache[LOCALMAP_CACHE_INDEX(romMethod, pc)];
+		UDATA const mapBytes = ((argTempCount + 31) / 32) * sizeof(U_32);
+		UDATA const generation = vm->localMapCacheGeneration;
+		UDATA const sequence = entry->sequence;
+
+		issueReadBarrier();
+		if ((0 == (sequence & 1)) && (entry->romMethod == romMethod) && (entry->pc == pc)) {
+			memcpy(resultArrayBase, entry->bits, mapBytes);
+			issueReadBarrier();
+			if (sequence == entry->sequence) {
+				return 0;
+			}
+		}
+
+		rc = vm->localMapFunction(PORTLIB, romClass, romMethod, pc, resultArrayBase, vm, j9mapmemory_GetBuffer, j9mapmemory_ReleaseBuffer);
+		if ((0 == rc) && (0 == (sequence & 1))
+		&& (sequence == compareAndSwapUDATA((uintptr_t *)&entry->sequence, sequence, sequence + 1))
+		) {
+			/* The entry is claimed; only store the map if no flush started since it was computed */
+			if (generation == vm->localMapCacheGeneration) {
+				entry->romMethod = romMethod;
+				entry->pc = pc;
+				memcpy(entry->bits, resultArrayBase, mapBytes);
+			}
+			issueWriteBarrier();
+			entry->sequence = sequence + 2;
+		}
+	} else {
+		rc = vm->localMapFunction(PORTLIB, romClass, romMethod, pc, resultArrayBase, vm, j9mapmemory_GetBuffer, j9mapmemory_ReleaseBuffer);
+	}
+
+	return rc;
+}
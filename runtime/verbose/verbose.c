@@ -121,6 +121,7 @@ static void verboseHookClassUnload (J9HookInterface** hook, UDATA eventNum, void
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
 #if (defined(J9VM_OPT_DYNAMIC_LOAD_SUPPORT)) 
 void reportDynloadStatistics (struct J9JavaVM *javaVM, struct J9ClassLoader *loader, struct J9ROMClass *romClass, struct J9TranslationLocalBuffer *localBuffer);
+static void reportDynloadSummary (J9JavaVM *javaVM);
 #endif /* J9VM_OPT_DYNAMIC_LOAD_SUPPORT */
 static void dumpQualifiedSize (J9PortLibrary* portLib, UDATA byteSize, const char* optionName, U_32 module_name, U_32 message_num);
 static void verboseEmptyOSlotIterator (J9VMThread * currentThread, J9StackWalkState * walkState, j9object_t * objectSlot, const void * stackLocation);
@@ -468,6 +469,12 @@ void reportDynloadStatistics(struct J9JavaVM *javaVM, struct J9ClassLoader *load
 	/* localBuffer should not be NULL */
 	Assert_VRB_true(NULL != localBuffer);
 
+	/* Accumulate the phase times for the summary printed at shutdown */
+	dynamicLoadStats->classCount += 1;
+	dynamicLoadStats->totalReadTime += dynamicLoadStats->readEndTime - dynamicLoadStats->readStartTime;
+	dynamicLoadStats->totalLoadTime += dynamicLoadStats->loadEndTime - dynamicLoadStats->loadStartTime;
+	dynamicLoadStats->totalTranslateTime += dynamicLoadStats->translateEndTime - dynamicLoadStats->translateStartTime;
+
 	if (NULL != localBuffer->cpEntryUsed) {
 		j9tty_printf(PORTLIB,
 			 "<Loaded %.*s from %.*s>\n<  Class size %i; ROM size %i; debug size %i>\n<  Read time %i usec; Load time %i usec; Translate time %i usec>\n",
@@ -533,6 +540,32 @@ void reportDynloadStatistics(struct J9JavaVM *javaVM, struct J9ClassLoader *load
 #endif /* J9VM_OPT_DYNAMIC_LOAD_SUPPORT */
 
 
+#if (defined(J9VM_OPT_DYNAMIC_LOAD_SUPPORT)) 
+/**
+ * Print the totals accumulated by reportDynloadStatistics() as a -verbose:dynload summary.
+ *
+ * @param[in] javaVM the J9JavaVM
+ */
+static void
+reportDynloadSummary(J9JavaVM *javaVM)
+{
+	J9TranslationBufferSet *dynamicLoadBuffers = javaVM->dynamicLoadBuffers;
+
+	if ((NULL != dynamicLoadBuffers) && (NULL != dynamicLoadBuffers->dynamicLoadStats)) {
+		J9DynamicLoadStats *dynamicLoadStats = dynamicLoadBuffers->dynamicLoadStats;
+		PORT_ACCESS_FROM_JAVAVM(javaVM);
+
+		j9tty_printf(PORTLIB,
+			"<Dynamic load summary: %zu classes>\n<  Total read time %llu usec; Total load time %llu usec; Total translate time %llu usec>\n",
+			dynamicLoadStats->classCount,
+			dynamicLoadStats->totalReadTime,
+			dynamicLoadStats->totalLoadTime,
+			dynamicLoadStats->totalTranslateTime);
+	}
+}
+#endif /* J9VM_OPT_DYNAMIC_LOAD_SUPPORT */
+
+
 #if (defined(J9VM_OPT_DYNAMIC_LOAD_SUPPORT)) 
 void hookDynamicLoadReporting(J9TranslationBufferSet *dynamicLoadBuffers)
 {
@@ -823,6 +856,11 @@ IDATA J9VMDllMain(J9JavaVM* vm, IDATA stage, void* reserved) {
 			if ((NULL != mmFuncTable) && (NULL != mmFuncTable->gcDebugVerboseShutdownLogging)){
 				mmFuncTable->gcDebugVerboseShutdownLogging(vm, 0);
 			}
+#if defined(J9VM_OPT_DYNAMIC_LOAD_SUPPORT)
+			if (J9_ARE_ANY_BITS_SET(vm->verboseLevel, VERBOSE_DYNLOAD)) {
+				reportDynloadSummary(vm);
+			}
+#endif /* defined(J9VM_OPT_DYNAMIC_LOAD_SUPPORT) */
 			break;
 
 		case VERBOSE_TEARDOWN_STAGE :
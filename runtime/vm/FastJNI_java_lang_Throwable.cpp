@@ -57,6 +57,11 @@ Fast_java_lang_Throwable_fillInStackTrace(J9VMThread *currentThread, j9object_t
 				walkFlags |= J9_STACKWALK_HIDE_EXCEPTION_FRAMES;
 				walkState->restartException = receiver;
 			}
+			/* Limit the capture if -XX:MaxJavaStackTraceDepth= is in effect */
+			if (0 != vm->maxStackTraceDepth) {
+				walkFlags |= J9_STACKWALK_COUNT_SPECIFIED;
+				walkState->maxFrames = vm->maxStackTraceDepth;
+			}
 			walkState->flags = walkFlags;
 			walkState->skipCount = 1;	/* skip the INL frame */
 #if JAVA_SPEC_VERSION >= 15
@@ -28,13 +28,49 @@
 #if defined(J9UNIX) || defined(AIXPPC)
 #include <sys/mman.h>
 #endif /* J9UNIX || AIXPPC */
+#if defined(LINUX)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif /* LINUX */
 #include "ut_j9vm.h"
 #include "AtomicSupport.hpp"
 
+#if defined(LINUX) && defined(__NR_membarrier)
+/* Command values from linux/membarrier.h, which older build hosts may not provide */
+#define J9_MEMBARRIER_CMD_QUERY 0
+#define J9_MEMBARRIER_CMD_PRIVATE_EXPEDITED (1 << 3)
+#define J9_MEMBARRIER_CMD_REGISTER_PRIVATE_EXPEDITED (1 << 4)
+#define J9_USE_MEMBARRIER
+#endif /* LINUX && __NR_membarrier */
+
 extern "C" {
 
 #if defined(J9VM_INTERP_ATOMIC_FREE_JNI_USES_FLUSH)
 
+#if defined(J9_USE_MEMBARRIER)
+/* Registration for expedited membarrier is per process, so this is shared by all VMs */
+static bool membarrierRegistered = false;
+
+/**
+ * Register this process for MEMBARRIER_CMD_PRIVATE_EXPEDITED if the kernel supports it.
+ *
+ * @return true if flushProcessWriteBuffers can use membarrier, false to fall back to the guard page
+ */
+static bool
+registerMembarrier()
+{
+	if (!membarrierRegistered) {
+		long supported = syscall(__NR_membarrier, J9_MEMBARRIER_CMD_QUERY, 0);
+		if ((supported > 0) && J9_ARE_ALL_BITS_SET(supported, J9_MEMBARRIER_CMD_PRIVATE_EXPEDITED)) {
+			if (0 == syscall(__NR_membarrier, J9_MEMBARRIER_CMD_REGISTER_PRIVATE_EXPEDITED, 0)) {
+				membarrierRegistered = true;
+			}
+		}
+	}
+	return membarrierRegistered;
+}
+#endif /* J9_USE_MEMBARRIER */
+
 void
 flushProcessWriteBuffers(J9JavaVM *vm)
 {
@@ -46,6 +82,13 @@ flushProcessWriteBuffers(J9JavaVM *vm)
 		((VOID (WINAPI*)(void))vm->flushFunction)();
 	}
 #elif defined(J9UNIX) || defined(AIXPPC) /* WIN32 */
+#if defined(J9_USE_MEMBARRIER)
+	if (membarrierRegistered) {
+		/* Interrupts only the CPUs currently running threads of this process, without a TLB shootdown */
+		long membarrierrc = syscall(__NR_membarrier, J9_MEMBARRIER_CMD_PRIVATE_EXPEDITED, 0);
+		Assert_VM_true(0 == membarrierrc);
+	} else
+#endif /* J9_USE_MEMBARRIER */
 	if (NULL != vm->flushMutex) {
 		omrthread_monitor_enter(vm->flushMutex);
 		void *addr = vm->exclusiveGuardPage.address;
@@ -66,6 +109,12 @@ UDATA
 initializeExclusiveAccess(J9JavaVM *vm)
 {
 	UDATA rc = 0;
+#if defined(J9_USE_MEMBARRIER)
+	if (registerMembarrier()) {
+		/* The guard page and its mutex are only needed as the fallback */
+		return rc;
+	}
+#endif /* J9_USE_MEMBARRIER */
 #if defined(LINUX) || defined(AIXPPC)
 	PORT_ACCESS_FROM_JAVAVM(vm);
 	UDATA pageSize = j9vmem_supported_page_sizes()[0];
@@ -93,6 +93,21 @@ static void fixDecompilationRecords(J9VMThread * vmThread, UDATA delta, UDATA ol
 UDATA   growJavaStack(J9VMThread * vmThread, UDATA newStackSize)
 {
 	UDATA rc;
+	UDATA geometricStackSize = vmThread->stackObject->size * 2;
+
+	/* Grow geometrically (bounded by -Xss) so that deep recursion pays for the copy and
+	 * frame fixup a logarithmic number of times rather than once per -Xssi increment.
+	 * If the larger stack cannot be allocated, fall back to the requested size.
+	 */
+	if (geometricStackSize > vmThread->javaVM->stackSize) {
+		geometricStackSize = vmThread->javaVM->stackSize;
+	}
+	if (geometricStackSize > newStackSize) {
+		rc = internalGrowJavaStack(vmThread, geometricStackSize);
+		if (0 == rc) {
+			return rc;
+		}
+	}
 
 	rc = internalGrowJavaStack(vmThread, newStackSize);
 	if (0 != rc) {
@@ -836,6 +836,8 @@ freeJavaVM(J9JavaVM * vm)
 	}
 #endif
 
+	j9localmap_FreeCache(vm);
+
 	shutdownVMHookInterface(vm);
 
 	freeSystemProperties(vm);
@@ -2354,6 +2356,15 @@ IDATA VMInitStages(J9JavaVM *vm, IDATA stage, void* reserved) {
 				}
 			}
 
+			/* 0 (the default) captures every frame */
+			vm->maxStackTraceDepth = 0;
+			if ((argIndex = FIND_AND_CONSUME_ARG(STARTSWITH_MATCH, VMOPT_XXMAXJAVASTACKTRACEDEPTH_EQUALS, NULL)) >= 0) {
+				UDATA depth = 0;
+				char *optname = VMOPT_XXMAXJAVASTACKTRACEDEPTH_EQUALS;
+				GET_INTEGER_VALUE(argIndex, optname, depth);
+				vm->maxStackTraceDepth = depth;
+			}
+
 #if defined(J9VM_OPT_VALHALLA_VALUE_TYPES)
 			/* By default flattening is disabled */
 			vm->valueFlatteningThreshold = 0;
@@ -6551,6 +6562,8 @@ protectedInitializeJavaVM(J9PortLibrary* portLibrary, void * userData)
 	}
 #endif
 
+	j9localmap_InitializeCache(vm);
+
 #ifdef J9VM_OPT_ZIP_SUPPORT
 	if (NULL == vm->zipCachePool) {
 		vm->zipCachePool = zipCachePool_new(portLibrary, vm);
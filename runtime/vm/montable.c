@@ -281,13 +281,14 @@ monitorTableAt(J9VMThread* vmStruct, j9object_t object)
 	} else {
 		objectMonitor = hashTableFind(monitorTable, &key_objectMonitor);
 		if (objectMonitor == NULL) {
-			omrthread_monitor_t monitor;
+			omrthread_monitor_t monitor = NULL;
 			UDATA monitorFlags = J9THREAD_MONITOR_OBJECT;
 
-			key_objectMonitor.alternateLockword = 0;
-
+			/* Create the monitor without holding the table mutex, so that inflation of
+			 * unrelated objects on other threads is not serialized behind the allocation.
+			 */
+			omrthread_monitor_exit(mutex);
 			if (omrthread_monitor_init_with_name(&monitor, monitorFlags, NULL) == 0) {
-				TRACE("Adding monitor");
 				((J9ThreadAbstractMonitor*)monitor)->userData = (UDATA) object;
 
 #if defined(J9VM_INTERP_CUSTOM_SPIN_OPTIONS)
@@ -314,7 +315,21 @@ monitorTableAt(J9VMThread* vmStruct, j9object_t object)
 				}
 #endif /* OMR_THR_CUSTOM_SPIN_OPTIONS */				
 #endif /* J9VM_INTERP_CUSTOM_SPIN_OPTIONS */
+			} else {
+				monitor = NULL;
+			}
+			omrthread_monitor_enter(mutex);
 
+			/* Another thread may have inflated the same object while the mutex was released */
+			objectMonitor = hashTableFind(monitorTable, &key_objectMonitor);
+			if (NULL != objectMonitor) {
+				TRACE("Found monitor");
+				if (NULL != monitor) {
+					omrthread_monitor_destroy(monitor);
+				}
+			} else if (NULL != monitor) {
+				TRACE("Adding monitor");
+				key_objectMonitor.alternateLockword = 0;
 				key_objectMonitor.monitor = monitor;
 
 #ifdef J9VM_THR_SMART_DEFLATION
@@ -329,7 +344,6 @@ monitorTableAt(J9VMThread* vmStruct, j9object_t object)
 				}
 			} else {
 				TRACE("Out of memory creating omrthread_monitor_t");
-				objectMonitor = NULL;
 			}
 		} else {
 			TRACE("Found monitor");
@@ -45,16 +45,26 @@ compareUncompressedUnicode(J9VMThread *vmThread, j9object_t unicodeBytes1, j9obj
 {
 	UDATA result = 1;
 	if (unicodeBytes1 != unicodeBytes2) {
-		UDATA i = 0;
-		while (0 != length) {
-			U_16 unicodeChar1 = J9JAVAARRAYOFCHAR_LOAD(vmThread, unicodeBytes1, i);
-			U_16 unicodeChar2 = J9JAVAARRAYOFCHAR_LOAD(vmThread, unicodeBytes2, i);
-			if (unicodeChar1 != unicodeChar2) {
+#if !defined(J9VM_GC_ALWAYS_CALL_OBJECT_ACCESS_BARRIER)
+		/* Contiguous arrays can be compared with memcmp, which is vectorized by the C library */
+		if (J9ISCONTIGUOUSARRAY(vmThread, unicodeBytes1) && J9ISCONTIGUOUSARRAY(vmThread, unicodeBytes2)) {
+			if (0 != memcmp(J9JAVAARRAYCONTIGUOUS_EA(vmThread, unicodeBytes1, 0, U_16), J9JAVAARRAYCONTIGUOUS_EA(vmThread, unicodeBytes2, 0, U_16), length * sizeof(U_16))) {
 				result = 0;
-				break;
 			}
-			length -= 1;
-			i += 1;
+		} else
+#endif /* !defined(J9VM_GC_ALWAYS_CALL_OBJECT_ACCESS_BARRIER) */
+		{
+			UDATA i = 0;
+			while (0 != length) {
+				U_16 unicodeChar1 = J9JAVAARRAYOFCHAR_LOAD(vmThread, unicodeBytes1, i);
+				U_16 unicodeChar2 = J9JAVAARRAYOFCHAR_LOAD(vmThread, unicodeBytes2, i);
+				if (unicodeChar1 != unicodeChar2) {
+					result = 0;
+					break;
+				}
+				length -= 1;
+				i += 1;
+			}
 		}
 	}
 	return result;
@@ -73,16 +83,26 @@ compareCompressedUnicode(J9VMThread *vmThread, j9object_t unicodeBytes1, j9objec
 {
 	UDATA result = 1;
 	if (unicodeBytes1 != unicodeBytes2) {
-		UDATA i = 0;
-		while (0 != length) {
-			U_16 unicodeChar1 = (U_16)J9JAVAARRAYOFBYTE_LOAD(vmThread, unicodeBytes1, i);
-			U_16 unicodeChar2 = (U_16)J9JAVAARRAYOFBYTE_LOAD(vmThread, unicodeBytes2, i);
-			if (unicodeChar1 != unicodeChar2) {
+#if !defined(J9VM_GC_ALWAYS_CALL_OBJECT_ACCESS_BARRIER)
+		/* Contiguous arrays can be compared with memcmp, which is vectorized by the C library */
+		if (J9ISCONTIGUOUSARRAY(vmThread, unicodeBytes1) && J9ISCONTIGUOUSARRAY(vmThread, unicodeBytes2)) {
+			if (0 != memcmp(J9JAVAARRAYCONTIGUOUS_EA(vmThread, unicodeBytes1, 0, I_8), J9JAVAARRAYCONTIGUOUS_EA(vmThread, unicodeBytes2, 0, I_8), length * sizeof(I_8))) {
 				result = 0;
-				break;
 			}
-			length -= 1;
-			i += 1;
+		} else
+#endif /* !defined(J9VM_GC_ALWAYS_CALL_OBJECT_ACCESS_BARRIER) */
+		{
+			UDATA i = 0;
+			while (0 != length) {
+				U_16 unicodeChar1 = (U_16)J9JAVAARRAYOFBYTE_LOAD(vmThread, unicodeBytes1, i);
+				U_16 unicodeChar2 = (U_16)J9JAVAARRAYOFBYTE_LOAD(vmThread, unicodeBytes2, i);
+				if (unicodeChar1 != unicodeChar2) {
+					result = 0;
+					break;
+				}
+				length -= 1;
+				i += 1;
+			}
 		}
 	}
 	return result;
@@ -1465,7 +1465,7 @@ getLocalsMap(J9StackWalkState * walkState, J9ROMClass * romClass, J9ROMMethod *
 #ifdef J9VM_INTERP_STACKWALK_TRACING
 	swPrintf(walkState, 4, "\tUsing local mapper\n");
 #endif
-	errorCode = vm->localMapFunction(PORTLIB, romClass, romMethod, offsetPC, result, vm, j9mapmemory_GetBuffer, j9mapmemory_ReleaseBuffer);
+	errorCode = j9localmap_CachedLocalBitsForPC(vm, romClass, romMethod, offsetPC, result, argTempCount);
 
 	if (errorCode < 0) {
 		/* Local map failed, result = %p - aborting VM - needs new message TBD */
@@ -46,7 +46,11 @@ checkModuleAccess(J9VMThread *currentThread, J9JavaVM* vm, J9ROMClass* srcRomCla
 			}
 		}
 
-		if (J9_VISIBILITY_ALLOWED == result) {
+		/* Unnamed and open modules export all of their packages, so skip the package lookup and the mutex */
+		if ((J9_VISIBILITY_ALLOWED == result)
+			&& !J9_IS_J9MODULE_UNNAMED(vm, destModule)
+			&& !J9_IS_J9MODULE_OPEN(destModule)
+		) {
 			const U_8* packageName = NULL;
 			UDATA packageNameLength = 0;
 			J9PackageIDTableEntry entry = {0};